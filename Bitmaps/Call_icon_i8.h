@@ -0,0 +1,598 @@
+// Call_icon_i8.h
+// Made by Bitmaps/lvimg2ili.py --lvgl from Call_icon.h; do not edit.
+// 91x91 pixels, 108 colors, LV_IMG_CF_INDEXED_8BIT
+#include "../lvgl/lvgl.h"
+
+static const uint8_t Call_icon_i8_map[9305] = {
+  0xF8, 0xFC, 0xF8, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF, 0x10, 0x0C, 0x10, 0xFF, 0x08, 0x0C, 0x08, 0xFF,
+  0xF8, 0xF4, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x08, 0x08, 0x08, 0xFF, 0x10, 0x10, 0x10, 0xFF,
+  0x08, 0x04, 0x08, 0xFF, 0x00, 0x04, 0x00, 0xFF, 0xF0, 0xF0, 0xF0, 0xFF, 0xF0, 0xF4, 0xF0, 0xFF,
+  0x18, 0x18, 0x18, 0xFF, 0x10, 0x14, 0x10, 0xFF, 0xE0, 0xE0, 0xE0, 0xFF, 0xE8, 0xE4, 0xE8, 0xFF,
+  0xF0, 0xEC, 0xF0, 0xFF, 0x48, 0x48, 0x48, 0xFF, 0x18, 0x14, 0x18, 0xFF, 0xE8, 0xE8, 0xE8, 0xFF,
+  0xF8, 0xF0, 0xF8, 0xFF, 0xC8, 0xC8, 0xC8, 0xFF, 0xC8, 0xC4, 0xC8, 0xFF, 0x68, 0x68, 0x68, 0xFF,
+  0x50, 0x50, 0x50, 0xFF, 0x70, 0x70, 0x70, 0xFF, 0x58, 0x58, 0x58, 0xFF, 0xD0, 0xD0, 0xD0, 0xFF,
+  0x20, 0x20, 0x20, 0xFF, 0x30, 0x2C, 0x30, 0xFF, 0xC0, 0xC0, 0xC0, 0xFF, 0x40, 0x40, 0x40, 0xFF,
+  0xA0, 0xA0, 0xA0, 0xFF, 0x30, 0x30, 0x30, 0xFF, 0x90, 0x90, 0x90, 0xFF, 0x98, 0x98, 0x98, 0xFF,
+  0x80, 0x80, 0x80, 0xFF, 0x38, 0x34, 0x38, 0xFF, 0xB0, 0xAC, 0xB0, 0xFF, 0x78, 0x74, 0x78, 0xFF,
+  0xA0, 0x9C, 0xA0, 0xFF, 0xA8, 0xA4, 0xA8, 0xFF, 0x60, 0x60, 0x60, 0xFF, 0x70, 0x6C, 0x70, 0xFF,
+  0xD8, 0xD4, 0xD8, 0xFF, 0x48, 0x44, 0x48, 0xFF, 0x38, 0x3C, 0x38, 0xFF, 0x40, 0x44, 0x40, 0xFF,
+  0xD8, 0xD8, 0xD8, 0xFF, 0xE0, 0xDC, 0xE0, 0xFF, 0x88, 0x84, 0x88, 0xFF, 0x28, 0x28, 0x28, 0xFF,
+  0x50, 0x54, 0x50, 0xFF, 0xB0, 0xB0, 0xB0, 0xFF, 0xC0, 0xBC, 0xC0, 0xFF, 0x78, 0x78, 0x78, 0xFF,
+  0x88, 0x88, 0x88, 0xFF, 0x40, 0x3C, 0x40, 0xFF, 0xB8, 0xB8, 0xB8, 0xFF, 0x58, 0x54, 0x58, 0xFF,
+  0x18, 0x1C, 0x18, 0xFF, 0xB8, 0xB4, 0xB8, 0xFF, 0x28, 0x24, 0x28, 0xFF, 0x68, 0x64, 0x68, 0xFF,
+  0x28, 0x2C, 0x28, 0xFF, 0x38, 0x38, 0x38, 0xFF, 0x60, 0x5C, 0x60, 0xFF, 0x68, 0x6C, 0x68, 0xFF,
+  0x98, 0x94, 0x98, 0xFF, 0x50, 0x4C, 0x50, 0xFF, 0xE0, 0xE4, 0xE0, 0xFF, 0xA8, 0xA8, 0xA8, 0xFF,
+  0x60, 0x64, 0x60, 0xFF, 0x80, 0x7C, 0x80, 0xFF, 0xD0, 0xCC, 0xD0, 0xFF, 0x00, 0x08, 0x00, 0xFF,
+  0x10, 0x08, 0x10, 0xFF, 0x20, 0x1C, 0x20, 0xFF, 0x48, 0x4C, 0x48, 0xFF, 0xE8, 0xEC, 0xE8, 0xFF,
+  0x08, 0x10, 0x08, 0xFF, 0xD0, 0xD4, 0xD0, 0xFF, 0x08, 0x00, 0x08, 0xFF, 0xA0, 0xA4, 0xA0, 0xFF,
+  0xB8, 0xBC, 0xB8, 0xFF, 0x78, 0x7C, 0x78, 0xFF, 0x30, 0x34, 0x30, 0xFF, 0x90, 0x94, 0x90, 0xFF,
+  0x70, 0x74, 0x70, 0xFF, 0x88, 0x8C, 0x88, 0xFF, 0xB0, 0xB4, 0xB0, 0xFF, 0xC8, 0xCC, 0xC8, 0xFF,
+  0x90, 0x8C, 0x90, 0xFF, 0xB0, 0xA0, 0xA0, 0xFF, 0x48, 0x44, 0x40, 0xFF, 0xB8, 0xAC, 0xB0, 0xFF,
+  0xF0, 0xE8, 0xF0, 0xFF, 0x20, 0x24, 0x20, 0xFF, 0x80, 0x84, 0x80, 0xFF, 0xF0, 0xF8, 0xF0, 0xFF,
+  0x58, 0x5C, 0x58, 0xFF, 0x68, 0x60, 0x68, 0xFF, 0x30, 0x28, 0x30, 0xFF, 0x60, 0x58, 0x60, 0xFF,
+  0xC8, 0xC0, 0xC8, 0xFF, 0x98, 0x9C, 0x98, 0xFF, 0xA8, 0xAC, 0xA8, 0xFF, 0xB0, 0xA8, 0xB0, 0xFF,
+  0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x5D, 0x5E, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x22, 0x05,
+  0x05, 0x05, 0x05, 0x1D, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x1D, 0x05, 0x06, 0x12, 0x06, 0x02, 0x4B, 0x24,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x04, 0x01, 0x00, 0x01, 0x04, 0x00, 0x00, 0x01, 0x04, 0x00, 0x01, 0x00,
+  0x01, 0x56, 0x06, 0x09, 0x02, 0x03, 0x07, 0x03, 0x02, 0x06, 0x0C, 0x13, 0x00, 0x60, 0x00, 0x00,
+  0x01, 0x01, 0x00, 0x00, 0x14, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0A, 0x01, 0x00, 0x00, 0x04,
+  0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x14, 0x00, 0x1E, 0x25, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x14, 0x00, 0x00, 0x04, 0x01,
+  0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x01, 0x01, 0x00, 0x17, 0x05, 0x08, 0x06, 0x03, 0x02,
+  0x02, 0x03, 0x02, 0x03, 0x02, 0x05, 0x1A, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x22, 0x05, 0x0C, 0x05, 0x3C, 0x15, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01,
+  0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x0F, 0x00, 0x23, 0x09, 0x06, 0x02, 0x03, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03,
+  0x06, 0x05, 0x3D, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+  0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x10, 0x2E, 0x08,
+  0x09, 0x07, 0x09, 0x05, 0x1A, 0x26, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+  0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x27, 0x2F, 0x00,
+  0x00, 0x3E, 0x05, 0x07, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x2E, 0x01, 0x01,
+  0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x1B, 0x05, 0x03, 0x07, 0x05, 0x02, 0x03, 0x06,
+  0x05, 0x3F, 0x30, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x00,
+  0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x01, 0x0A, 0x00, 0x00, 0x44, 0x05, 0x05, 0x28, 0x00, 0x31, 0x05, 0x0C, 0x06,
+  0x07, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x4C, 0x05, 0x57, 0x00, 0x00, 0x01, 0x0B, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x15, 0x05, 0x05, 0x05, 0x05, 0x12, 0x0D, 0x05, 0x03, 0x08, 0x07, 0x32, 0x00,
+  0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00,
+  0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x26, 0x05, 0x05, 0x06, 0x1F, 0x00, 0x00, 0x11, 0x05, 0x07, 0x06, 0x02, 0x03, 0x02, 0x02,
+  0x03, 0x02, 0x03, 0x06, 0x05, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00,
+  0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x16, 0x0D, 0x02, 0x06, 0x08, 0x06, 0x07, 0x03, 0x06, 0x05, 0x06, 0x00, 0x00, 0x04, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0x0B, 0x00, 0x00, 0x04,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x00, 0x4D, 0x05, 0x06, 0x02,
+  0x05, 0x17, 0x00, 0x00, 0x02, 0x06, 0x07, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x07, 0x05,
+  0x4E, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04,
+  0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x2E, 0x06,
+  0x03, 0x06, 0x06, 0x07, 0x03, 0x05, 0x33, 0x16, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x29, 0x05, 0x02, 0x03, 0x02, 0x03, 0x0C, 0x31, 0x00, 0x20,
+  0x05, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x06, 0x26, 0x00, 0x04, 0x00,
+  0x00, 0x04, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x29, 0x21, 0x05, 0x03, 0x02, 0x03,
+  0x03, 0x08, 0x0D, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01,
+  0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x05, 0x05, 0x02, 0x02, 0x03, 0x06, 0x05, 0x4E, 0x00, 0x04, 0x34, 0x05, 0x02, 0x02, 0x03,
+  0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x09, 0x11, 0x0A, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04,
+  0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x01, 0x04, 0x00, 0x00, 0x00, 0x00, 0x10, 0x22, 0x05, 0x09, 0x02, 0x03, 0x06, 0x05, 0x05, 0x11,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x16, 0x03, 0x0D, 0x03, 0x02,
+  0x03, 0x02, 0x06, 0x05, 0x30, 0x00, 0x35, 0x03, 0x06, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03,
+  0x02, 0x03, 0x05, 0x57, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x01, 0x01,
+  0x04, 0x00, 0x00, 0x1B, 0x33, 0x05, 0x06, 0x07, 0x0C, 0x06, 0x05, 0x1A, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x61, 0x08, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x05,
+  0x00, 0x00, 0x2B, 0x06, 0x02, 0x06, 0x02, 0x03, 0x02, 0x03, 0x03, 0x06, 0x0C, 0x06, 0x05, 0x0E,
+  0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x3F, 0x05, 0x07, 0x07, 0x02, 0x09, 0x05, 0x18, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x04, 0x00,
+  0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x25, 0x05, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x08, 0x62, 0x00, 0x01, 0x05, 0x06,
+  0x06, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x06, 0x03, 0x05, 0x18, 0x00, 0x01, 0x0B, 0x00, 0x00,
+  0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x05, 0x07, 0x06,
+  0x07, 0x0D, 0x05, 0x45, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x36, 0x0C, 0x06, 0x03, 0x02,
+  0x02, 0x03, 0x02, 0x03, 0x02, 0x05, 0x0C, 0x16, 0x00, 0x20, 0x05, 0x07, 0x03, 0x02, 0x02, 0x03,
+  0x03, 0x03, 0x07, 0x02, 0x03, 0x05, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0x00,
+  0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x31, 0x1A, 0x10, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x37, 0x05, 0x06, 0x03, 0x02, 0x0C, 0x05, 0x38,
+  0x00, 0x04, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x17, 0x05, 0x07, 0x03, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03,
+  0x08, 0x05, 0x58, 0x00, 0x00, 0x12, 0x05, 0x03, 0x03, 0x02, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x03, 0x0C, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x32, 0x05, 0x05, 0x21, 0x13, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x04, 0x00, 0x00,
+  0x04, 0x01, 0x00, 0x00, 0x37, 0x05, 0x0D, 0x08, 0x0C, 0x08, 0x05, 0x3D, 0x00, 0x00, 0x00, 0x04,
+  0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+  0x00, 0x19, 0x05, 0x07, 0x4C, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x06, 0x0C, 0x05, 0x29, 0x00,
+  0x0F, 0x05, 0x06, 0x03, 0x06, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x06, 0x06, 0x37, 0x00, 0x01,
+  0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x27, 0x05,
+  0x06, 0x09, 0x05, 0x17, 0x16, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00,
+  0x19, 0x05, 0x03, 0x03, 0x06, 0x06, 0x1C, 0x10, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x19, 0x05, 0x07, 0x03,
+  0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x06, 0x05, 0x40, 0x00, 0x00, 0x2B, 0x05, 0x06, 0x07,
+  0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x08, 0x09, 0x1C, 0x2C, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01,
+  0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x09, 0x02, 0x03, 0x06, 0x06, 0x09, 0x05,
+  0x20, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x19, 0x05, 0x06, 0x03,
+  0x06, 0x05, 0x2F, 0x10, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x05, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03,
+  0x02, 0x03, 0x02, 0x06, 0x05, 0x17, 0x00, 0x46, 0x33, 0x09, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03,
+  0x02, 0x06, 0x02, 0x05, 0x58, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x01, 0x04, 0x00, 0x1E, 0x05, 0x06, 0x08, 0x06, 0x07, 0x03, 0x05, 0x05, 0x18, 0x10, 0x00, 0x04,
+  0x00, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x27, 0x05, 0x0C, 0x02, 0x03, 0x05, 0x23, 0x00,
+  0x14, 0x63, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x10, 0x34, 0x08, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x06,
+  0x05, 0x00, 0x00, 0x3F, 0x05, 0x05, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x03, 0x05,
+  0x2C, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x4F,
+  0x41, 0x03, 0x05, 0x02, 0x06, 0x1C, 0x08, 0x0D, 0x05, 0x0E, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x4F, 0x39, 0x4B, 0x02, 0x03, 0x06, 0x05, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
+  0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x10, 0x11, 0x09, 0x02,
+  0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x06, 0x33, 0x00, 0x00, 0x21,
+  0x02, 0x03, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x06, 0x18, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x1C, 0x06, 0x02,
+  0x09, 0x02, 0x03, 0x06, 0x05, 0x13, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x3D,
+  0x0C, 0x06, 0x02, 0x03, 0x08, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x13, 0x1F, 0x08, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x0C, 0x0C, 0x35, 0x00, 0x0F, 0x05, 0x02, 0x02, 0x03, 0x02,
+  0x02, 0x03, 0x02, 0x03, 0x07, 0x06, 0x05, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x26, 0x0C, 0x06, 0x07, 0x09, 0x02, 0x07,
+  0x05, 0x16, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x24, 0x08, 0x03, 0x02, 0x07,
+  0x09, 0x47, 0x00, 0x04, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x0F, 0x11, 0x09, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x03, 0x03,
+  0x02, 0x07, 0x05, 0x25, 0x0E, 0x00, 0x27, 0x05, 0x03, 0x02, 0x03, 0x02, 0x02, 0x06, 0x12, 0x03,
+  0x05, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01,
+  0x01, 0x00, 0x00, 0x01, 0x00, 0x31, 0x48, 0x05, 0x08, 0x50, 0x07, 0x06, 0x0D, 0x1B, 0x00, 0x00,
+  0x00, 0x01, 0x01, 0x00, 0x00, 0x14, 0x00, 0x08, 0x03, 0x12, 0x07, 0x05, 0x21, 0x00, 0x00, 0x01,
+  0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x0A, 0x18, 0x09,
+  0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x07, 0x06, 0x02, 0x05, 0x3A,
+  0x00, 0x51, 0x05, 0x06, 0x03, 0x02, 0x03, 0x03, 0x1C, 0x05, 0x05, 0x1A, 0x0A, 0x00, 0x01, 0x01,
+  0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x38, 0x05, 0x4D, 0x0D, 0x02, 0x05, 0x05, 0x0F, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04,
+  0x00, 0x00, 0x0E, 0x05, 0x03, 0x06, 0x07, 0x06, 0x32, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x3F, 0x05, 0x03, 0x02, 0x03, 0x02, 0x02,
+  0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x06, 0x03, 0x03, 0x0C, 0x05, 0x0E, 0x00, 0x35, 0x05, 0x02,
+  0x03, 0x02, 0x08, 0x05, 0x21, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x3D, 0x05,
+  0x05, 0x07, 0x12, 0x06, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x42, 0x05,
+  0x03, 0x07, 0x05, 0x2F, 0x13, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x2B, 0x05, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x03, 0x03, 0x02, 0x03,
+  0x02, 0x02, 0x02, 0x02, 0x06, 0x05, 0x18, 0x00, 0x01, 0x2F, 0x05, 0x07, 0x05, 0x21, 0x64, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00,
+  0x00, 0x04, 0x00, 0x00, 0x01, 0x0B, 0x00, 0x00, 0x01, 0x00, 0x28, 0x05, 0x03, 0x02, 0x06, 0x05,
+  0x59, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x51, 0x08, 0x06, 0x02, 0x02, 0x05, 0x5A,
+  0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B,
+  0x05, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x07,
+  0x0D, 0x05, 0x3A, 0x00, 0x16, 0x03, 0x05, 0x17, 0x30, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x01, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x65, 0x09, 0x02, 0x07, 0x07, 0x05, 0x3A, 0x00, 0x00, 0x01,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x48, 0x05, 0x03, 0x02, 0x06, 0x2D, 0x0A, 0x00, 0x00, 0x01, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x17, 0x05, 0x06, 0x03, 0x02, 0x03,
+  0x02, 0x03, 0x02, 0x03, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x06, 0x05, 0x07, 0x40, 0x00, 0x00,
+  0x1D, 0x0A, 0x00, 0x01, 0x04, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00,
+  0x10, 0x00, 0x05, 0x05, 0x08, 0x06, 0x08, 0x34, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0A, 0x00,
+  0x28, 0x06, 0x03, 0x02, 0x03, 0x05, 0x01, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x05, 0x02, 0x06, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x02,
+  0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x07, 0x07, 0x05, 0x43, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x0A, 0x00, 0x00, 0x04,
+  0x01, 0x00, 0x01, 0x0A, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x07,
+  0x03, 0x03, 0x05, 0x32, 0x00, 0x14, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x2D, 0x05, 0x02, 0x06,
+  0x05, 0x38, 0x00, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x5B, 0x1C, 0x06, 0x07, 0x03, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x02, 0x03,
+  0x02, 0x07, 0x09, 0x11, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01,
+  0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x5C, 0x05, 0x02, 0x03, 0x09, 0x1F, 0x13,
+  0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x27, 0x09, 0x06, 0x03, 0x06, 0x05, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x1D, 0x09, 0x02, 0x03,
+  0x03, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x06, 0x02, 0x05, 0x04, 0x00,
+  0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x30, 0x41, 0x09, 0x02, 0x03, 0x05, 0x15, 0x00, 0x01, 0x00, 0x00, 0x01,
+  0x04, 0x00, 0x00, 0x02, 0x06, 0x03, 0x06, 0x05, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x1D, 0x09, 0x02, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03,
+  0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x07, 0x07, 0x05, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x01, 0x00,
+  0x04, 0x0B, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x00,
+  0x1A, 0x09, 0x03, 0x07, 0x05, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x09, 0x08,
+  0x07, 0x06, 0x06, 0x45, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x01, 0x00, 0x39, 0x05, 0x06, 0x02, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x02,
+  0x03, 0x02, 0x05, 0x11, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01,
+  0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x66, 0x03, 0x02, 0x0D,
+  0x05, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x35, 0x05, 0x03, 0x02, 0x06, 0x40, 0x00,
+  0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0E, 0x09, 0x03,
+  0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x09, 0x05, 0x00,
+  0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00,
+  0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+  0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x3B, 0x05, 0x03, 0x08, 0x09, 0x23, 0x00, 0x01, 0x00,
+  0x00, 0x04, 0x00, 0x00, 0x00, 0x05, 0x03, 0x02, 0x03, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x52, 0x50, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01,
+  0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x13, 0x05, 0x07, 0x07, 0x06, 0x07, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0x03, 0x02, 0x06, 0x3C, 0x16, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x0C, 0x08, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03,
+  0x02, 0x03, 0x02, 0x07, 0x05, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01,
+  0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x05, 0x03,
+  0x06, 0x07, 0x06, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x25, 0x09, 0x03, 0x06, 0x05,
+  0x37, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x15,
+  0x05, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x06, 0x02, 0x05,
+  0x45, 0x00, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0x0B, 0x00,
+  0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x18, 0x05, 0x03, 0x06, 0x07, 0x4A, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x26, 0x05, 0x02, 0x03, 0x05, 0x17, 0x00, 0x01, 0x01, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x05, 0x07, 0x03, 0x02, 0x03,
+  0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x07, 0x07, 0x05, 0x3E, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x01, 0x00, 0x01, 0x01, 0x00, 0x00,
+  0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x1B, 0x05, 0x0D, 0x02, 0x09, 0x1A, 0x00, 0x00, 0x04, 0x01, 0x00, 0x01,
+  0x00, 0x1E, 0x05, 0x02, 0x02, 0x05, 0x19, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x11, 0x08, 0x06, 0x06, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02,
+  0x03, 0x02, 0x02, 0x03, 0x02, 0x06, 0x03, 0x23, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00,
+  0x00, 0x01, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x13,
+  0x05, 0x02, 0x03, 0x52, 0x11, 0x00, 0x01, 0x0B, 0x00, 0x00, 0x04, 0x00, 0x15, 0x05, 0x03, 0x02,
+  0x05, 0x2B, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00,
+  0x00, 0x35, 0x05, 0x09, 0x02, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x03, 0x05, 0x1A, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x0F, 0x05, 0x02, 0x02, 0x05, 0x11,
+  0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x1E, 0x05, 0x02, 0x03, 0x05, 0x42, 0x00, 0x00, 0x04,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x1C, 0x02, 0x07,
+  0x02, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x05, 0x47, 0x00,
+  0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x0A, 0x00, 0x00, 0x00, 0x01, 0x4F, 0x05, 0x03, 0x02, 0x05, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x15, 0x05, 0x03, 0x02, 0x09, 0x18, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x14, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x37, 0x05, 0x08, 0x03, 0x02, 0x03, 0x02, 0x03,
+  0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x09, 0x25, 0x0B, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x04, 0x01, 0x00, 0x01, 0x0B, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+  0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00,
+  0x10, 0x05, 0x02, 0x03, 0x05, 0x18, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x2C, 0x03, 0x06,
+  0x02, 0x08, 0x2E, 0x46, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04,
+  0x00, 0x00, 0x00, 0x20, 0x07, 0x06, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02,
+  0x03, 0x02, 0x03, 0x07, 0x05, 0x24, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x46, 0x05, 0x03, 0x02, 0x09,
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x2C, 0x02, 0x03, 0x03, 0x08, 0x39, 0x0E, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25,
+  0x4B, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x05, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0x00,
+  0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x13, 0x05, 0x02, 0x03, 0x52, 0x34, 0x00, 0x00, 0x00, 0x01,
+  0x01, 0x00, 0x00, 0x51, 0x07, 0x06, 0x02, 0x09, 0x41, 0x0F, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x42, 0x0D, 0x06, 0x02, 0x03, 0x02,
+  0x02, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x08, 0x33, 0x00, 0x00, 0x04,
+  0x00, 0x00, 0x04, 0x0B, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00,
+  0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04,
+  0x00, 0x13, 0x05, 0x02, 0x07, 0x09, 0x11, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x04, 0x15, 0x05,
+  0x03, 0x02, 0x08, 0x2F, 0x31, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+  0x01, 0x01, 0x00, 0x01, 0x0B, 0x00, 0x05, 0x03, 0x06, 0x03, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03,
+  0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x06, 0x0D, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01,
+  0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0F, 0x05, 0x06, 0x02,
+  0x05, 0x11, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x1E, 0x05, 0x02, 0x03, 0x08, 0x4E, 0x10,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x0A,
+  0x00, 0x17, 0x05, 0x02, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02,
+  0x03, 0x02, 0x05, 0x41, 0x13, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+  0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0F, 0x43, 0x2F, 0x05, 0x05, 0x2D, 0x00, 0x04, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x15, 0x05, 0x02, 0x03, 0x05, 0x48, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0A, 0x05, 0x06, 0x07,
+  0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x05, 0x53,
+  0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
+  0x04, 0x01, 0x00, 0x00, 0x0E, 0x54, 0x5A, 0x15, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x16,
+  0x05, 0x03, 0x07, 0x05, 0x19, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x04, 0x01,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x44, 0x09, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03,
+  0x02, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x0D, 0x08, 0x05, 0x0E, 0x00, 0x00, 0x01, 0x01,
+  0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x01, 0x16, 0x05, 0x05, 0x03, 0x05, 0x55,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x4A, 0x06, 0x06, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03,
+  0x02, 0x02, 0x03, 0x06, 0x03, 0x05, 0x3B, 0x00, 0x01, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+  0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00,
+  0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04,
+  0x00, 0x00, 0x00, 0x0A, 0x00, 0x36, 0x33, 0x39, 0x1C, 0x05, 0x3F, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x27,
+  0x05, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x06, 0x07,
+  0x08, 0x05, 0x36, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+  0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x01,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x3A, 0x48, 0x54, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x2C, 0x3E, 0x09, 0x02, 0x03, 0x02,
+  0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x07, 0x40, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00,
+  0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+  0x04, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x04, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x2D, 0x05, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03,
+  0x02, 0x03, 0x03, 0x03, 0x02, 0x03, 0x02, 0x08, 0x05, 0x17, 0x00, 0x00, 0x00, 0x04, 0x01, 0x00,
+  0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04,
+  0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00,
+  0x00, 0x0A, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x04,
+  0x00, 0x00, 0x06, 0x06, 0x06, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03,
+  0x02, 0x03, 0x0D, 0x08, 0x1C, 0x1B, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x01, 0x01,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x49, 0x05, 0x06,
+  0x03, 0x02, 0x03, 0x02, 0x03, 0x03, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x06, 0x09,
+  0x2A, 0x0A, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01,
+  0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x00,
+  0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01,
+  0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x1D, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x03, 0x03, 0x02, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x08, 0x05, 0x1B, 0x00, 0x01, 0x01,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00,
+  0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01, 0x0B,
+  0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x35, 0x05, 0x06, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x03, 0x02, 0x02,
+  0x03, 0x02, 0x03, 0x07, 0x06, 0x07, 0x03, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x14, 0x00,
+  0x49, 0x06, 0x09, 0x02, 0x06, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x02, 0x06, 0x05, 0x2A, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x04, 0x00, 0x00, 0x04, 0x0B, 0x00, 0x00, 0x01, 0x01, 0x00, 0x04, 0x01, 0x00, 0x00, 0x01,
+  0x01, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00,
+  0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x36, 0x12, 0x09, 0x06, 0x03,
+  0x02, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x05, 0x3A,
+  0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00,
+  0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01,
+  0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x19, 0x08, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02,
+  0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x07, 0x03, 0x05, 0x06, 0x15, 0x00, 0x00, 0x04, 0x00,
+  0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x0F, 0x24, 0x54,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x0A, 0x00, 0x00, 0x04,
+  0x00, 0x00, 0x00, 0x05, 0x07, 0x06, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x02,
+  0x03, 0x02, 0x03, 0x02, 0x06, 0x05, 0x21, 0x0B, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x14,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x3C, 0x02, 0x03, 0x45, 0x0A, 0x0B, 0x00, 0x00,
+  0x00, 0x0A, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x05,
+  0x07, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x06, 0x05, 0x2A, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x0A, 0x00, 0x01,
+  0x23, 0x05, 0x09, 0x06, 0x03, 0x06, 0x05, 0x28, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x04, 0x01, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01,
+  0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x3B, 0x05, 0x02, 0x02, 0x03, 0x02,
+  0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x07, 0x02, 0x05, 0x28, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x16, 0x1F, 0x05, 0x07, 0x0C, 0x05, 0x02,
+  0x03, 0x07, 0x05, 0x01, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+  0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00,
+  0x04, 0x01, 0x00, 0x01, 0x01, 0x0B, 0x39, 0x05, 0x06, 0x07, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x07, 0x03, 0x06, 0x05, 0x32, 0x00, 0x00, 0x04, 0x00, 0x00,
+  0x01, 0x00, 0x30, 0x34, 0x06, 0x06, 0x08, 0x03, 0x07, 0x06, 0x06, 0x02, 0x03, 0x05, 0x3B, 0x00,
+  0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x01, 0x01, 0x00, 0x01, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x53, 0x05, 0x05, 0x07, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x02,
+  0x03, 0x02, 0x03, 0x02, 0x03, 0x06, 0x2B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x05, 0x09,
+  0x07, 0x08, 0x02, 0x03, 0x02, 0x03, 0x02, 0x02, 0x50, 0x06, 0x20, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00,
+  0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x17, 0x05, 0x08,
+  0x03, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x09, 0x08, 0x05, 0x47, 0x04, 0x47, 0x23, 0x00, 0x0A, 0x2A, 0x05, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x02, 0x03, 0x02, 0x06, 0x05, 0x1F, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00,
+  0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x01, 0x00, 0x01, 0x01,
+  0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x39, 0x05, 0x02, 0x07, 0x06, 0x02, 0x02,
+  0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x07, 0x07, 0x09, 0x05, 0x05,
+  0x05, 0x05, 0x15, 0x00, 0x1E, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x07,
+  0x05, 0x37, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0x01,
+  0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x00, 0x00, 0x2C, 0x05, 0x0D, 0x02, 0x07, 0x03, 0x02, 0x02, 0x03, 0x03, 0x03, 0x02,
+  0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x4D, 0x00, 0x00,
+  0x42, 0x05, 0x06, 0x03, 0x02, 0x02, 0x03, 0x02, 0x02, 0x06, 0x03, 0x06, 0x07, 0x0A, 0x00, 0x01,
+  0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01,
+  0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01,
+  0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0x0B, 0x00,
+  0x20, 0x05, 0x03, 0x07, 0x03, 0x02, 0x03, 0x02, 0x03, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x06, 0x05, 0x17, 0x00, 0x00, 0x05, 0x08, 0x02, 0x03,
+  0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x05, 0x21, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x04,
+  0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00,
+  0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x32, 0x05, 0x05, 0x02,
+  0x03, 0x02, 0x03, 0x02, 0x03, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x03, 0x02, 0x07, 0x07, 0x41, 0x0E, 0x00, 0x3D, 0x05, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02,
+  0x03, 0x02, 0x03, 0x05, 0x0F, 0x00, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+  0x01, 0x00, 0x00, 0x04, 0x01, 0x00, 0x01, 0x0B, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x04, 0x00, 0x00, 0x01, 0x00, 0x10, 0x2E, 0x05, 0x06, 0x03, 0x02, 0x03, 0x02, 0x02,
+  0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x0D, 0x05,
+  0x1A, 0x00, 0x00, 0x3E, 0x05, 0x0D, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x08, 0x06, 0x05,
+  0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00,
+  0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x4A, 0x05, 0x06, 0x07, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x02,
+  0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x08, 0x07, 0x09, 0x4A, 0x00, 0x30, 0x05,
+  0x02, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x07, 0x06, 0x38, 0x00, 0x04, 0x00, 0x00,
+  0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x0B, 0x00, 0x0E,
+  0x05, 0x03, 0x06, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x03, 0x02, 0x03, 0x06, 0x06, 0x02, 0x09, 0x0C, 0x01, 0x00, 0x27, 0x05, 0x07, 0x02, 0x03, 0x02,
+  0x03, 0x02, 0x03, 0x02, 0x07, 0x05, 0x12, 0x5B, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x04, 0x00, 0x00, 0x04, 0x0B, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+  0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x2C, 0x05, 0x03, 0x03, 0x02,
+  0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x03, 0x02, 0x05, 0x29, 0x00, 0x0F, 0x56, 0x06, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x03, 0x05, 0x24, 0x00, 0x04, 0x0B, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x04, 0x01, 0x00, 0x01, 0x04,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x29, 0x08, 0x06, 0x03, 0x03, 0x03, 0x02, 0x02, 0x03,
+  0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x05, 0x00,
+  0x00, 0x38, 0x05, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x02, 0x05, 0x26, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00,
+  0x00, 0x01, 0x01, 0x24, 0x08, 0x06, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x02,
+  0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x06, 0x18, 0x00, 0x00, 0x1D, 0x09, 0x02,
+  0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x07, 0x0C, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x19,
+  0x05, 0x05, 0x06, 0x02, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x03, 0x02, 0x06, 0x06, 0x02, 0x09, 0x44, 0x00, 0x0E, 0x05, 0x07, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x03, 0x02, 0x03, 0x12, 0x05, 0x19, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01, 0x04, 0x00, 0x00,
+  0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+  0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01,
+  0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x00, 0x00, 0x42, 0x05, 0x07, 0x03, 0x02,
+  0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x03,
+  0x05, 0x3B, 0x00, 0x00, 0x2A, 0x09, 0x03, 0x06, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x12,
+  0x09, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+  0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x24, 0x08, 0x08, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x05, 0x38, 0x00, 0x0A,
+  0x08, 0x06, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x06, 0x07, 0x1F, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04,
+  0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x14, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x20, 0x05, 0x06, 0x07, 0x02, 0x06, 0x07, 0x03, 0x02, 0x02, 0x03, 0x02, 0x02,
+  0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x12, 0x07, 0x0B, 0x00, 0x69, 0x05, 0x02, 0x03, 0x02,
+  0x03, 0x02, 0x03, 0x4C, 0x03, 0x02, 0x06, 0x02, 0x6A, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x04,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01,
+  0x00, 0x01, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x1E,
+  0x05, 0x06, 0x02, 0x07, 0x08, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x03, 0x02, 0x09, 0x08, 0x1F, 0x00, 0x01, 0x2E, 0x05, 0x07, 0x07, 0x02, 0x03, 0x03, 0x03, 0x02,
+  0x03, 0x02, 0x05, 0x49, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+  0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04,
+  0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00,
+  0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x31, 0x05, 0x03, 0x08, 0x0D,
+  0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x12, 0x06, 0x05,
+  0x0E, 0x00, 0x15, 0x06, 0x06, 0x06, 0x06, 0x02, 0x03, 0x03, 0x02, 0x03, 0x02, 0x05, 0x55, 0x04,
+  0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x01,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x25, 0x09, 0x06, 0x06, 0x07, 0x03, 0x02, 0x03,
+  0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x06, 0x02, 0x09, 0x07, 0x00, 0x00, 0x3B, 0x06,
+  0x07, 0x02, 0x03, 0x02, 0x03, 0x07, 0x02, 0x06, 0x05, 0x22, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00,
+  0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01,
+  0x04, 0x00, 0x00, 0x00, 0x22, 0x05, 0x05, 0x0D, 0x06, 0x03, 0x03, 0x03, 0x02, 0x03, 0x02, 0x02,
+  0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x5C, 0x00, 0x00, 0x05, 0x03, 0x07, 0x08, 0x03, 0x07,
+  0x0D, 0x05, 0x05, 0x59, 0x01, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04,
+  0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x29, 0x2D, 0x05, 0x07, 0x02, 0x03, 0x03, 0x02, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x03, 0x08, 0x0D, 0x16, 0x00, 0x28, 0x05, 0x07, 0x06, 0x02, 0x02, 0x05, 0x43, 0x6B, 0x00, 0x00,
+  0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x44, 0x05, 0x05,
+  0x06, 0x03, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x08, 0x55, 0x00,
+  0x00, 0x2D, 0x09, 0x06, 0x05, 0x0C, 0x1E, 0x00, 0x00, 0x00, 0x0A, 0x01, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x04, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x00,
+  0x00, 0x01, 0x01, 0x00, 0x01, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x3C, 0x08, 0x05, 0x08, 0x0D,
+  0x06, 0x06, 0x06, 0x07, 0x03, 0x02, 0x07, 0x03, 0x06, 0x05, 0x16, 0x00, 0x36, 0x05, 0x3C, 0x2B,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x13, 0x43, 0x2D, 0x05, 0x08, 0x05, 0x06, 0x02, 0x02, 0x03,
+  0x03, 0x02, 0x07, 0x06, 0x02, 0x07, 0x00, 0x00, 0x22, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x0F, 0x53, 0x22, 0x12, 0x05, 0x05, 0x05, 0x05, 0x06, 0x03, 0x06, 0x06, 0x05,
+  0x05, 0x29, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0A, 0x46, 0x0E, 0x28, 0x34, 0x0C, 0x03, 0x3E, 0x43, 0x15, 0x13, 0x0A, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const lv_img_dsc_t Call_icon_i8 = {
+  .header.always_zero = 0,
+  .header.w = 91,
+  .header.h = 91,
+  .data_size = 9305,
+  .header.cf = LV_IMG_CF_INDEXED_8BIT,
+  .data = Call_icon_i8_map,
+};
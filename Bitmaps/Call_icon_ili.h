@@ -0,0 +1,540 @@
+// Call_icon_ili.h
+// Made by Bitmaps/lvimg2ili.py from Call_icon.h; do not edit.
+// 91x91 pixels, 108 colors, top row first, standard RGB565
+#include <stdint.h>
+
+#define CALL_ICON_W 91
+#define CALL_ICON_H 91
+
+// ILI9341_DrawBitmapPal8(x, y, Call_icon_pal, Call_icon_pal8, 91, 91);
+static const uint16_t Call_icon_pal[108] = {
+  0xFFFF, 0xFFDF, 0x1062, 0x0861, 0xFFBF, 0x0000, 0x0841, 0x1082, 0x0821, 0x0020, 0xF79E, 0xF7BE, 0x18C3, 0x10A2, 0xE71C, 0xEF3D,
+  0xF77E, 0x4A49, 0x18A3, 0xEF5D, 0xFF9F, 0xCE59, 0xCE39, 0x6B4D, 0x528A, 0x738E, 0x5ACB, 0xD69A, 0x2104, 0x3166, 0xC618, 0x4208,
+  0xA514, 0x3186, 0x9492, 0x9CD3, 0x8410, 0x39A7, 0xB576, 0x7BAF, 0xA4F4, 0xAD35, 0x630C, 0x736E, 0xDEBB, 0x4A29, 0x39E7, 0x4228,
+  0xDEDB, 0xE6FC, 0x8C31, 0x2945, 0x52AA, 0xB596, 0xC5F8, 0x7BCF, 0x8C51, 0x41E8, 0xBDD7, 0x5AAB, 0x18E3, 0xBDB7, 0x2925, 0x6B2D,
+  0x2965, 0x39C7, 0x62EC, 0x6B6D, 0x9CB3, 0x526A, 0xE73C, 0xAD55, 0x632C, 0x83F0, 0xD67A, 0x0040, 0x1042, 0x20E4, 0x4A69, 0xEF7D,
+  0x0881, 0xD6BA, 0x0801, 0xA534, 0xBDF7, 0x7BEF, 0x31A6, 0x94B2, 0x73AE, 0x8C71, 0xB5B6, 0xCE79, 0x9472, 0xA516, 0x4229, 0xB577,
+  0xF75E, 0x2124, 0x8430, 0xF7DE, 0x5AEB, 0x6B0D, 0x3146, 0x62CC, 0xCE19, 0x9CF3, 0xAD75, 0xB556,
+};
+
+static const uint8_t Call_icon_pal8[8281] = {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x5D, 0x5E, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x22, 0x05,
+  0x05, 0x05, 0x05, 0x1D, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x1D, 0x05, 0x06, 0x12, 0x06, 0x02, 0x4B, 0x24,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x04, 0x01, 0x00, 0x01, 0x04, 0x00, 0x00, 0x01, 0x04, 0x00, 0x01, 0x00,
+  0x01, 0x56, 0x06, 0x09, 0x02, 0x03, 0x07, 0x03, 0x02, 0x06, 0x0C, 0x13, 0x00, 0x60, 0x00, 0x00,
+  0x01, 0x01, 0x00, 0x00, 0x14, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0A, 0x01, 0x00, 0x00, 0x04,
+  0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x14, 0x00, 0x1E, 0x25, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x14, 0x00, 0x00, 0x04, 0x01,
+  0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x01, 0x01, 0x00, 0x17, 0x05, 0x08, 0x06, 0x03, 0x02,
+  0x02, 0x03, 0x02, 0x03, 0x02, 0x05, 0x1A, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x22, 0x05, 0x0C, 0x05, 0x3C, 0x15, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01,
+  0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x0F, 0x00, 0x23, 0x09, 0x06, 0x02, 0x03, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03,
+  0x06, 0x05, 0x3D, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+  0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x10, 0x2E, 0x08,
+  0x09, 0x07, 0x09, 0x05, 0x1A, 0x26, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+  0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x27, 0x2F, 0x00,
+  0x00, 0x3E, 0x05, 0x07, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x2E, 0x01, 0x01,
+  0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x1B, 0x05, 0x03, 0x07, 0x05, 0x02, 0x03, 0x06,
+  0x05, 0x3F, 0x30, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x00,
+  0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x01, 0x0A, 0x00, 0x00, 0x44, 0x05, 0x05, 0x28, 0x00, 0x31, 0x05, 0x0C, 0x06,
+  0x07, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x4C, 0x05, 0x57, 0x00, 0x00, 0x01, 0x0B, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x15, 0x05, 0x05, 0x05, 0x05, 0x12, 0x0D, 0x05, 0x03, 0x08, 0x07, 0x32, 0x00,
+  0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00,
+  0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x26, 0x05, 0x05, 0x06, 0x1F, 0x00, 0x00, 0x11, 0x05, 0x07, 0x06, 0x02, 0x03, 0x02, 0x02,
+  0x03, 0x02, 0x03, 0x06, 0x05, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00,
+  0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x16, 0x0D, 0x02, 0x06, 0x08, 0x06, 0x07, 0x03, 0x06, 0x05, 0x06, 0x00, 0x00, 0x04, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0x0B, 0x00, 0x00, 0x04,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x00, 0x4D, 0x05, 0x06, 0x02,
+  0x05, 0x17, 0x00, 0x00, 0x02, 0x06, 0x07, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x07, 0x05,
+  0x4E, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04,
+  0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x2E, 0x06,
+  0x03, 0x06, 0x06, 0x07, 0x03, 0x05, 0x33, 0x16, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x29, 0x05, 0x02, 0x03, 0x02, 0x03, 0x0C, 0x31, 0x00, 0x20,
+  0x05, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x06, 0x26, 0x00, 0x04, 0x00,
+  0x00, 0x04, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x29, 0x21, 0x05, 0x03, 0x02, 0x03,
+  0x03, 0x08, 0x0D, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01,
+  0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x05, 0x05, 0x02, 0x02, 0x03, 0x06, 0x05, 0x4E, 0x00, 0x04, 0x34, 0x05, 0x02, 0x02, 0x03,
+  0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x09, 0x11, 0x0A, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04,
+  0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x01, 0x04, 0x00, 0x00, 0x00, 0x00, 0x10, 0x22, 0x05, 0x09, 0x02, 0x03, 0x06, 0x05, 0x05, 0x11,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x16, 0x03, 0x0D, 0x03, 0x02,
+  0x03, 0x02, 0x06, 0x05, 0x30, 0x00, 0x35, 0x03, 0x06, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03,
+  0x02, 0x03, 0x05, 0x57, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x01, 0x01,
+  0x04, 0x00, 0x00, 0x1B, 0x33, 0x05, 0x06, 0x07, 0x0C, 0x06, 0x05, 0x1A, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x61, 0x08, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x05,
+  0x00, 0x00, 0x2B, 0x06, 0x02, 0x06, 0x02, 0x03, 0x02, 0x03, 0x03, 0x06, 0x0C, 0x06, 0x05, 0x0E,
+  0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x3F, 0x05, 0x07, 0x07, 0x02, 0x09, 0x05, 0x18, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x04, 0x00,
+  0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x25, 0x05, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x08, 0x62, 0x00, 0x01, 0x05, 0x06,
+  0x06, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x06, 0x03, 0x05, 0x18, 0x00, 0x01, 0x0B, 0x00, 0x00,
+  0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x05, 0x07, 0x06,
+  0x07, 0x0D, 0x05, 0x45, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x36, 0x0C, 0x06, 0x03, 0x02,
+  0x02, 0x03, 0x02, 0x03, 0x02, 0x05, 0x0C, 0x16, 0x00, 0x20, 0x05, 0x07, 0x03, 0x02, 0x02, 0x03,
+  0x03, 0x03, 0x07, 0x02, 0x03, 0x05, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0x00,
+  0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x31, 0x1A, 0x10, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x37, 0x05, 0x06, 0x03, 0x02, 0x0C, 0x05, 0x38,
+  0x00, 0x04, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x17, 0x05, 0x07, 0x03, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03,
+  0x08, 0x05, 0x58, 0x00, 0x00, 0x12, 0x05, 0x03, 0x03, 0x02, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x03, 0x0C, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x32, 0x05, 0x05, 0x21, 0x13, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x04, 0x00, 0x00,
+  0x04, 0x01, 0x00, 0x00, 0x37, 0x05, 0x0D, 0x08, 0x0C, 0x08, 0x05, 0x3D, 0x00, 0x00, 0x00, 0x04,
+  0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+  0x00, 0x19, 0x05, 0x07, 0x4C, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x06, 0x0C, 0x05, 0x29, 0x00,
+  0x0F, 0x05, 0x06, 0x03, 0x06, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x06, 0x06, 0x37, 0x00, 0x01,
+  0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x27, 0x05,
+  0x06, 0x09, 0x05, 0x17, 0x16, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00,
+  0x19, 0x05, 0x03, 0x03, 0x06, 0x06, 0x1C, 0x10, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x19, 0x05, 0x07, 0x03,
+  0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x06, 0x05, 0x40, 0x00, 0x00, 0x2B, 0x05, 0x06, 0x07,
+  0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x08, 0x09, 0x1C, 0x2C, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01,
+  0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x09, 0x02, 0x03, 0x06, 0x06, 0x09, 0x05,
+  0x20, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x19, 0x05, 0x06, 0x03,
+  0x06, 0x05, 0x2F, 0x10, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x05, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03,
+  0x02, 0x03, 0x02, 0x06, 0x05, 0x17, 0x00, 0x46, 0x33, 0x09, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03,
+  0x02, 0x06, 0x02, 0x05, 0x58, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x01, 0x04, 0x00, 0x1E, 0x05, 0x06, 0x08, 0x06, 0x07, 0x03, 0x05, 0x05, 0x18, 0x10, 0x00, 0x04,
+  0x00, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x27, 0x05, 0x0C, 0x02, 0x03, 0x05, 0x23, 0x00,
+  0x14, 0x63, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x10, 0x34, 0x08, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x06,
+  0x05, 0x00, 0x00, 0x3F, 0x05, 0x05, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x03, 0x05,
+  0x2C, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x4F,
+  0x41, 0x03, 0x05, 0x02, 0x06, 0x1C, 0x08, 0x0D, 0x05, 0x0E, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x4F, 0x39, 0x4B, 0x02, 0x03, 0x06, 0x05, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
+  0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x10, 0x11, 0x09, 0x02,
+  0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x06, 0x33, 0x00, 0x00, 0x21,
+  0x02, 0x03, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x06, 0x18, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x1C, 0x06, 0x02,
+  0x09, 0x02, 0x03, 0x06, 0x05, 0x13, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x3D,
+  0x0C, 0x06, 0x02, 0x03, 0x08, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x13, 0x1F, 0x08, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x0C, 0x0C, 0x35, 0x00, 0x0F, 0x05, 0x02, 0x02, 0x03, 0x02,
+  0x02, 0x03, 0x02, 0x03, 0x07, 0x06, 0x05, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x26, 0x0C, 0x06, 0x07, 0x09, 0x02, 0x07,
+  0x05, 0x16, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x24, 0x08, 0x03, 0x02, 0x07,
+  0x09, 0x47, 0x00, 0x04, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x0F, 0x11, 0x09, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x03, 0x03,
+  0x02, 0x07, 0x05, 0x25, 0x0E, 0x00, 0x27, 0x05, 0x03, 0x02, 0x03, 0x02, 0x02, 0x06, 0x12, 0x03,
+  0x05, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01,
+  0x01, 0x00, 0x00, 0x01, 0x00, 0x31, 0x48, 0x05, 0x08, 0x50, 0x07, 0x06, 0x0D, 0x1B, 0x00, 0x00,
+  0x00, 0x01, 0x01, 0x00, 0x00, 0x14, 0x00, 0x08, 0x03, 0x12, 0x07, 0x05, 0x21, 0x00, 0x00, 0x01,
+  0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x0A, 0x18, 0x09,
+  0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x07, 0x06, 0x02, 0x05, 0x3A,
+  0x00, 0x51, 0x05, 0x06, 0x03, 0x02, 0x03, 0x03, 0x1C, 0x05, 0x05, 0x1A, 0x0A, 0x00, 0x01, 0x01,
+  0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x38, 0x05, 0x4D, 0x0D, 0x02, 0x05, 0x05, 0x0F, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04,
+  0x00, 0x00, 0x0E, 0x05, 0x03, 0x06, 0x07, 0x06, 0x32, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x3F, 0x05, 0x03, 0x02, 0x03, 0x02, 0x02,
+  0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x06, 0x03, 0x03, 0x0C, 0x05, 0x0E, 0x00, 0x35, 0x05, 0x02,
+  0x03, 0x02, 0x08, 0x05, 0x21, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x3D, 0x05,
+  0x05, 0x07, 0x12, 0x06, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x42, 0x05,
+  0x03, 0x07, 0x05, 0x2F, 0x13, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x2B, 0x05, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x03, 0x03, 0x02, 0x03,
+  0x02, 0x02, 0x02, 0x02, 0x06, 0x05, 0x18, 0x00, 0x01, 0x2F, 0x05, 0x07, 0x05, 0x21, 0x64, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00,
+  0x00, 0x04, 0x00, 0x00, 0x01, 0x0B, 0x00, 0x00, 0x01, 0x00, 0x28, 0x05, 0x03, 0x02, 0x06, 0x05,
+  0x59, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x51, 0x08, 0x06, 0x02, 0x02, 0x05, 0x5A,
+  0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B,
+  0x05, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x07,
+  0x0D, 0x05, 0x3A, 0x00, 0x16, 0x03, 0x05, 0x17, 0x30, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x01, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x65, 0x09, 0x02, 0x07, 0x07, 0x05, 0x3A, 0x00, 0x00, 0x01,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x48, 0x05, 0x03, 0x02, 0x06, 0x2D, 0x0A, 0x00, 0x00, 0x01, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x17, 0x05, 0x06, 0x03, 0x02, 0x03,
+  0x02, 0x03, 0x02, 0x03, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x06, 0x05, 0x07, 0x40, 0x00, 0x00,
+  0x1D, 0x0A, 0x00, 0x01, 0x04, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00,
+  0x10, 0x00, 0x05, 0x05, 0x08, 0x06, 0x08, 0x34, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0A, 0x00,
+  0x28, 0x06, 0x03, 0x02, 0x03, 0x05, 0x01, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x05, 0x02, 0x06, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x02,
+  0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x07, 0x07, 0x05, 0x43, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x0A, 0x00, 0x00, 0x04,
+  0x01, 0x00, 0x01, 0x0A, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x07,
+  0x03, 0x03, 0x05, 0x32, 0x00, 0x14, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x2D, 0x05, 0x02, 0x06,
+  0x05, 0x38, 0x00, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x5B, 0x1C, 0x06, 0x07, 0x03, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x02, 0x03,
+  0x02, 0x07, 0x09, 0x11, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01,
+  0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x5C, 0x05, 0x02, 0x03, 0x09, 0x1F, 0x13,
+  0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x27, 0x09, 0x06, 0x03, 0x06, 0x05, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x1D, 0x09, 0x02, 0x03,
+  0x03, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x06, 0x02, 0x05, 0x04, 0x00,
+  0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x30, 0x41, 0x09, 0x02, 0x03, 0x05, 0x15, 0x00, 0x01, 0x00, 0x00, 0x01,
+  0x04, 0x00, 0x00, 0x02, 0x06, 0x03, 0x06, 0x05, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x1D, 0x09, 0x02, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03,
+  0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x07, 0x07, 0x05, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x01, 0x00,
+  0x04, 0x0B, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x00,
+  0x1A, 0x09, 0x03, 0x07, 0x05, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x09, 0x08,
+  0x07, 0x06, 0x06, 0x45, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x01, 0x00, 0x39, 0x05, 0x06, 0x02, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x02,
+  0x03, 0x02, 0x05, 0x11, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01,
+  0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x66, 0x03, 0x02, 0x0D,
+  0x05, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x35, 0x05, 0x03, 0x02, 0x06, 0x40, 0x00,
+  0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0E, 0x09, 0x03,
+  0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x09, 0x05, 0x00,
+  0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00,
+  0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+  0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x3B, 0x05, 0x03, 0x08, 0x09, 0x23, 0x00, 0x01, 0x00,
+  0x00, 0x04, 0x00, 0x00, 0x00, 0x05, 0x03, 0x02, 0x03, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x52, 0x50, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01,
+  0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x13, 0x05, 0x07, 0x07, 0x06, 0x07, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0x03, 0x02, 0x06, 0x3C, 0x16, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x0C, 0x08, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03,
+  0x02, 0x03, 0x02, 0x07, 0x05, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01,
+  0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x05, 0x03,
+  0x06, 0x07, 0x06, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x25, 0x09, 0x03, 0x06, 0x05,
+  0x37, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x15,
+  0x05, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x06, 0x02, 0x05,
+  0x45, 0x00, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0x0B, 0x00,
+  0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x18, 0x05, 0x03, 0x06, 0x07, 0x4A, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x26, 0x05, 0x02, 0x03, 0x05, 0x17, 0x00, 0x01, 0x01, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x05, 0x07, 0x03, 0x02, 0x03,
+  0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x07, 0x07, 0x05, 0x3E, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x01, 0x00, 0x01, 0x01, 0x00, 0x00,
+  0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x1B, 0x05, 0x0D, 0x02, 0x09, 0x1A, 0x00, 0x00, 0x04, 0x01, 0x00, 0x01,
+  0x00, 0x1E, 0x05, 0x02, 0x02, 0x05, 0x19, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x11, 0x08, 0x06, 0x06, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02,
+  0x03, 0x02, 0x02, 0x03, 0x02, 0x06, 0x03, 0x23, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00,
+  0x00, 0x01, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x13,
+  0x05, 0x02, 0x03, 0x52, 0x11, 0x00, 0x01, 0x0B, 0x00, 0x00, 0x04, 0x00, 0x15, 0x05, 0x03, 0x02,
+  0x05, 0x2B, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00,
+  0x00, 0x35, 0x05, 0x09, 0x02, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x03, 0x05, 0x1A, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x0F, 0x05, 0x02, 0x02, 0x05, 0x11,
+  0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x1E, 0x05, 0x02, 0x03, 0x05, 0x42, 0x00, 0x00, 0x04,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x1C, 0x02, 0x07,
+  0x02, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x05, 0x47, 0x00,
+  0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x0A, 0x00, 0x00, 0x00, 0x01, 0x4F, 0x05, 0x03, 0x02, 0x05, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x15, 0x05, 0x03, 0x02, 0x09, 0x18, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x14, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x37, 0x05, 0x08, 0x03, 0x02, 0x03, 0x02, 0x03,
+  0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x09, 0x25, 0x0B, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x04, 0x01, 0x00, 0x01, 0x0B, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+  0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00,
+  0x10, 0x05, 0x02, 0x03, 0x05, 0x18, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x2C, 0x03, 0x06,
+  0x02, 0x08, 0x2E, 0x46, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04,
+  0x00, 0x00, 0x00, 0x20, 0x07, 0x06, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02,
+  0x03, 0x02, 0x03, 0x07, 0x05, 0x24, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x46, 0x05, 0x03, 0x02, 0x09,
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x2C, 0x02, 0x03, 0x03, 0x08, 0x39, 0x0E, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25,
+  0x4B, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x05, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0x00,
+  0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x13, 0x05, 0x02, 0x03, 0x52, 0x34, 0x00, 0x00, 0x00, 0x01,
+  0x01, 0x00, 0x00, 0x51, 0x07, 0x06, 0x02, 0x09, 0x41, 0x0F, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x42, 0x0D, 0x06, 0x02, 0x03, 0x02,
+  0x02, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x08, 0x33, 0x00, 0x00, 0x04,
+  0x00, 0x00, 0x04, 0x0B, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00,
+  0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04,
+  0x00, 0x13, 0x05, 0x02, 0x07, 0x09, 0x11, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x04, 0x15, 0x05,
+  0x03, 0x02, 0x08, 0x2F, 0x31, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+  0x01, 0x01, 0x00, 0x01, 0x0B, 0x00, 0x05, 0x03, 0x06, 0x03, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03,
+  0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x06, 0x0D, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01,
+  0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0F, 0x05, 0x06, 0x02,
+  0x05, 0x11, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x1E, 0x05, 0x02, 0x03, 0x08, 0x4E, 0x10,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x0A,
+  0x00, 0x17, 0x05, 0x02, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02,
+  0x03, 0x02, 0x05, 0x41, 0x13, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+  0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0F, 0x43, 0x2F, 0x05, 0x05, 0x2D, 0x00, 0x04, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x15, 0x05, 0x02, 0x03, 0x05, 0x48, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0A, 0x05, 0x06, 0x07,
+  0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x05, 0x53,
+  0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
+  0x04, 0x01, 0x00, 0x00, 0x0E, 0x54, 0x5A, 0x15, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x16,
+  0x05, 0x03, 0x07, 0x05, 0x19, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x04, 0x01,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x44, 0x09, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03,
+  0x02, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x0D, 0x08, 0x05, 0x0E, 0x00, 0x00, 0x01, 0x01,
+  0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x01, 0x16, 0x05, 0x05, 0x03, 0x05, 0x55,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x4A, 0x06, 0x06, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03,
+  0x02, 0x02, 0x03, 0x06, 0x03, 0x05, 0x3B, 0x00, 0x01, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+  0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00,
+  0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04,
+  0x00, 0x00, 0x00, 0x0A, 0x00, 0x36, 0x33, 0x39, 0x1C, 0x05, 0x3F, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x27,
+  0x05, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x06, 0x07,
+  0x08, 0x05, 0x36, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+  0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x01,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x3A, 0x48, 0x54, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x2C, 0x3E, 0x09, 0x02, 0x03, 0x02,
+  0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x07, 0x40, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00,
+  0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+  0x04, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x04, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x2D, 0x05, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03,
+  0x02, 0x03, 0x03, 0x03, 0x02, 0x03, 0x02, 0x08, 0x05, 0x17, 0x00, 0x00, 0x00, 0x04, 0x01, 0x00,
+  0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04,
+  0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00,
+  0x00, 0x0A, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x04,
+  0x00, 0x00, 0x06, 0x06, 0x06, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03,
+  0x02, 0x03, 0x0D, 0x08, 0x1C, 0x1B, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x01, 0x01,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x49, 0x05, 0x06,
+  0x03, 0x02, 0x03, 0x02, 0x03, 0x03, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x06, 0x09,
+  0x2A, 0x0A, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01,
+  0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x00,
+  0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01,
+  0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x1D, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x03, 0x03, 0x02, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x08, 0x05, 0x1B, 0x00, 0x01, 0x01,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00,
+  0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01, 0x0B,
+  0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x35, 0x05, 0x06, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x03, 0x02, 0x02,
+  0x03, 0x02, 0x03, 0x07, 0x06, 0x07, 0x03, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x14, 0x00,
+  0x49, 0x06, 0x09, 0x02, 0x06, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x02, 0x06, 0x05, 0x2A, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x04, 0x00, 0x00, 0x04, 0x0B, 0x00, 0x00, 0x01, 0x01, 0x00, 0x04, 0x01, 0x00, 0x00, 0x01,
+  0x01, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00,
+  0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x36, 0x12, 0x09, 0x06, 0x03,
+  0x02, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x05, 0x3A,
+  0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00,
+  0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01,
+  0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x19, 0x08, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02,
+  0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x07, 0x03, 0x05, 0x06, 0x15, 0x00, 0x00, 0x04, 0x00,
+  0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x0F, 0x24, 0x54,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x0A, 0x00, 0x00, 0x04,
+  0x00, 0x00, 0x00, 0x05, 0x07, 0x06, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x02,
+  0x03, 0x02, 0x03, 0x02, 0x06, 0x05, 0x21, 0x0B, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x14,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x3C, 0x02, 0x03, 0x45, 0x0A, 0x0B, 0x00, 0x00,
+  0x00, 0x0A, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x05,
+  0x07, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x06, 0x05, 0x2A, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x0A, 0x00, 0x01,
+  0x23, 0x05, 0x09, 0x06, 0x03, 0x06, 0x05, 0x28, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x04, 0x01, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01,
+  0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x3B, 0x05, 0x02, 0x02, 0x03, 0x02,
+  0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x07, 0x02, 0x05, 0x28, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x16, 0x1F, 0x05, 0x07, 0x0C, 0x05, 0x02,
+  0x03, 0x07, 0x05, 0x01, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+  0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00,
+  0x04, 0x01, 0x00, 0x01, 0x01, 0x0B, 0x39, 0x05, 0x06, 0x07, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x07, 0x03, 0x06, 0x05, 0x32, 0x00, 0x00, 0x04, 0x00, 0x00,
+  0x01, 0x00, 0x30, 0x34, 0x06, 0x06, 0x08, 0x03, 0x07, 0x06, 0x06, 0x02, 0x03, 0x05, 0x3B, 0x00,
+  0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x01, 0x01, 0x00, 0x01, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x53, 0x05, 0x05, 0x07, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x02,
+  0x03, 0x02, 0x03, 0x02, 0x03, 0x06, 0x2B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x05, 0x09,
+  0x07, 0x08, 0x02, 0x03, 0x02, 0x03, 0x02, 0x02, 0x50, 0x06, 0x20, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00,
+  0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x17, 0x05, 0x08,
+  0x03, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x09, 0x08, 0x05, 0x47, 0x04, 0x47, 0x23, 0x00, 0x0A, 0x2A, 0x05, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x02, 0x03, 0x02, 0x06, 0x05, 0x1F, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00,
+  0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x01, 0x00, 0x01, 0x01,
+  0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x39, 0x05, 0x02, 0x07, 0x06, 0x02, 0x02,
+  0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x07, 0x07, 0x09, 0x05, 0x05,
+  0x05, 0x05, 0x15, 0x00, 0x1E, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x07,
+  0x05, 0x37, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0x01,
+  0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x00, 0x00, 0x2C, 0x05, 0x0D, 0x02, 0x07, 0x03, 0x02, 0x02, 0x03, 0x03, 0x03, 0x02,
+  0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x4D, 0x00, 0x00,
+  0x42, 0x05, 0x06, 0x03, 0x02, 0x02, 0x03, 0x02, 0x02, 0x06, 0x03, 0x06, 0x07, 0x0A, 0x00, 0x01,
+  0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01,
+  0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01,
+  0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0x0B, 0x00,
+  0x20, 0x05, 0x03, 0x07, 0x03, 0x02, 0x03, 0x02, 0x03, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x06, 0x05, 0x17, 0x00, 0x00, 0x05, 0x08, 0x02, 0x03,
+  0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x05, 0x21, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x04,
+  0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00,
+  0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x32, 0x05, 0x05, 0x02,
+  0x03, 0x02, 0x03, 0x02, 0x03, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x03, 0x02, 0x07, 0x07, 0x41, 0x0E, 0x00, 0x3D, 0x05, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02,
+  0x03, 0x02, 0x03, 0x05, 0x0F, 0x00, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+  0x01, 0x00, 0x00, 0x04, 0x01, 0x00, 0x01, 0x0B, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x04, 0x00, 0x00, 0x01, 0x00, 0x10, 0x2E, 0x05, 0x06, 0x03, 0x02, 0x03, 0x02, 0x02,
+  0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x0D, 0x05,
+  0x1A, 0x00, 0x00, 0x3E, 0x05, 0x0D, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x08, 0x06, 0x05,
+  0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00,
+  0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x4A, 0x05, 0x06, 0x07, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x02,
+  0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x08, 0x07, 0x09, 0x4A, 0x00, 0x30, 0x05,
+  0x02, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x07, 0x06, 0x38, 0x00, 0x04, 0x00, 0x00,
+  0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x0B, 0x00, 0x0E,
+  0x05, 0x03, 0x06, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x03, 0x02, 0x03, 0x06, 0x06, 0x02, 0x09, 0x0C, 0x01, 0x00, 0x27, 0x05, 0x07, 0x02, 0x03, 0x02,
+  0x03, 0x02, 0x03, 0x02, 0x07, 0x05, 0x12, 0x5B, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x04, 0x00, 0x00, 0x04, 0x0B, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+  0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x2C, 0x05, 0x03, 0x03, 0x02,
+  0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x03, 0x02, 0x05, 0x29, 0x00, 0x0F, 0x56, 0x06, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x03, 0x05, 0x24, 0x00, 0x04, 0x0B, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x04, 0x01, 0x00, 0x01, 0x04,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x29, 0x08, 0x06, 0x03, 0x03, 0x03, 0x02, 0x02, 0x03,
+  0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x05, 0x00,
+  0x00, 0x38, 0x05, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x02, 0x05, 0x26, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00,
+  0x00, 0x01, 0x01, 0x24, 0x08, 0x06, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x02,
+  0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x06, 0x18, 0x00, 0x00, 0x1D, 0x09, 0x02,
+  0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x07, 0x0C, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x19,
+  0x05, 0x05, 0x06, 0x02, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x03, 0x02, 0x06, 0x06, 0x02, 0x09, 0x44, 0x00, 0x0E, 0x05, 0x07, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x03, 0x02, 0x03, 0x12, 0x05, 0x19, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01, 0x04, 0x00, 0x00,
+  0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+  0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01,
+  0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x00, 0x00, 0x42, 0x05, 0x07, 0x03, 0x02,
+  0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x03,
+  0x05, 0x3B, 0x00, 0x00, 0x2A, 0x09, 0x03, 0x06, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x12,
+  0x09, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+  0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x24, 0x08, 0x08, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x05, 0x38, 0x00, 0x0A,
+  0x08, 0x06, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x06, 0x07, 0x1F, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04,
+  0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x14, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x20, 0x05, 0x06, 0x07, 0x02, 0x06, 0x07, 0x03, 0x02, 0x02, 0x03, 0x02, 0x02,
+  0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x12, 0x07, 0x0B, 0x00, 0x69, 0x05, 0x02, 0x03, 0x02,
+  0x03, 0x02, 0x03, 0x4C, 0x03, 0x02, 0x06, 0x02, 0x6A, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x04,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01,
+  0x00, 0x01, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x1E,
+  0x05, 0x06, 0x02, 0x07, 0x08, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x03, 0x02, 0x09, 0x08, 0x1F, 0x00, 0x01, 0x2E, 0x05, 0x07, 0x07, 0x02, 0x03, 0x03, 0x03, 0x02,
+  0x03, 0x02, 0x05, 0x49, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+  0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04,
+  0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00,
+  0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x31, 0x05, 0x03, 0x08, 0x0D,
+  0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x12, 0x06, 0x05,
+  0x0E, 0x00, 0x15, 0x06, 0x06, 0x06, 0x06, 0x02, 0x03, 0x03, 0x02, 0x03, 0x02, 0x05, 0x55, 0x04,
+  0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x01,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x25, 0x09, 0x06, 0x06, 0x07, 0x03, 0x02, 0x03,
+  0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x06, 0x02, 0x09, 0x07, 0x00, 0x00, 0x3B, 0x06,
+  0x07, 0x02, 0x03, 0x02, 0x03, 0x07, 0x02, 0x06, 0x05, 0x22, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00,
+  0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01,
+  0x04, 0x00, 0x00, 0x00, 0x22, 0x05, 0x05, 0x0D, 0x06, 0x03, 0x03, 0x03, 0x02, 0x03, 0x02, 0x02,
+  0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x5C, 0x00, 0x00, 0x05, 0x03, 0x07, 0x08, 0x03, 0x07,
+  0x0D, 0x05, 0x05, 0x59, 0x01, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04,
+  0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x29, 0x2D, 0x05, 0x07, 0x02, 0x03, 0x03, 0x02, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x03, 0x08, 0x0D, 0x16, 0x00, 0x28, 0x05, 0x07, 0x06, 0x02, 0x02, 0x05, 0x43, 0x6B, 0x00, 0x00,
+  0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x44, 0x05, 0x05,
+  0x06, 0x03, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x08, 0x55, 0x00,
+  0x00, 0x2D, 0x09, 0x06, 0x05, 0x0C, 0x1E, 0x00, 0x00, 0x00, 0x0A, 0x01, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x04, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x00,
+  0x00, 0x01, 0x01, 0x00, 0x01, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x3C, 0x08, 0x05, 0x08, 0x0D,
+  0x06, 0x06, 0x06, 0x07, 0x03, 0x02, 0x07, 0x03, 0x06, 0x05, 0x16, 0x00, 0x36, 0x05, 0x3C, 0x2B,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x13, 0x43, 0x2D, 0x05, 0x08, 0x05, 0x06, 0x02, 0x02, 0x03,
+  0x03, 0x02, 0x07, 0x06, 0x02, 0x07, 0x00, 0x00, 0x22, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x0F, 0x53, 0x22, 0x12, 0x05, 0x05, 0x05, 0x05, 0x06, 0x03, 0x06, 0x06, 0x05,
+  0x05, 0x29, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0A, 0x46, 0x0E, 0x28, 0x34, 0x0C, 0x03, 0x3E, 0x43, 0x15, 0x13, 0x0A, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
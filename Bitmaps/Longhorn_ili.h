@@ -0,0 +1,97 @@
+// Longhorn_ili.h
+// Made by Bitmaps/lvimg2ili.py from Longhorn.h; do not edit.
+// 129x129 pixels, 66 colors, top row first, standard RGB565
+#include <stdint.h>
+
+#define LONGHORN_W 129
+#define LONGHORN_H 129
+
+// ILI9341_DrawBitmapRLE(x, y, Longhorn_rle, 129, 129);
+static const uint16_t Longhorn_rle[1360] = {
+  0x8081, 0x1084, 0x0842, 0x0863, 0x0842, 0x0863, 0x0842, 0x0863, 0x0842, 0x0863, 0x0842, 0x0863, 0x0842, 0x0863, 0x0842, 0x0863,
+  0x0842, 0x0863, 0x0842, 0x0863, 0x0842, 0x0863, 0x0842, 0x0863, 0x0842, 0x0863, 0x0842, 0x0863, 0x0842, 0x0863, 0x0842, 0x0863,
+  0x0842, 0x0863, 0x0842, 0x0863, 0x0842, 0x0863, 0x0842, 0x0863, 0x0842, 0x0863, 0x0842, 0x0863, 0x0842, 0x0863, 0x0842, 0x0863,
+  0x0842, 0x0863, 0x0842, 0x0863, 0x0842, 0x0863, 0x0842, 0x0863, 0x0842, 0x0863, 0x0842, 0x0863, 0x0842, 0x0863, 0x0842, 0x0863,
+  0x0842, 0x0863, 0x0842, 0x0863, 0x0842, 0x0863, 0x0842, 0x0863, 0x0842, 0x0863, 0x0842, 0x0863, 0x0842, 0x0863, 0x0842, 0x0863,
+  0x0842, 0x0863, 0x0842, 0x0863, 0x0842, 0x0863, 0x0842, 0x0863, 0x0842, 0x0863, 0x0842, 0x0863, 0x0842, 0x0863, 0x0842, 0x0863,
+  0x0842, 0x0863, 0x0842, 0x0863, 0x0842, 0x0863, 0x0842, 0x0863, 0x0842, 0x0863, 0x0842, 0x0863, 0x0842, 0x0863, 0x0842, 0x0863,
+  0x0842, 0x0863, 0x0842, 0x0863, 0x0842, 0x0863, 0x0842, 0x0863, 0x0842, 0x0863, 0x0842, 0x0863, 0x0842, 0x0863, 0x0842, 0x0863,
+  0x0842, 0xFFFF, 0x0080, 0x0000, 0x8001, 0xFFFF, 0x0080, 0x0000, 0x8001, 0xFFFF, 0x0080, 0x0000, 0x8001, 0xFFFF, 0x0080, 0x0000,
+  0x8001, 0xFFFF, 0x0080, 0x0000, 0x8001, 0xFFFF, 0x0080, 0x0000, 0x8001, 0xFFFF, 0x0080, 0x0000, 0x8001, 0xFFFF, 0x0080, 0x0000,
+  0x8001, 0xFFFF, 0x0080, 0x0000, 0x8001, 0xFFFF, 0x0080, 0x0000, 0x8001, 0xFFFF, 0x0080, 0x0000, 0x8001, 0xFFFF, 0x0080, 0x0000,
+  0x8001, 0xFFFF, 0x0080, 0x0000, 0x8001, 0xFFFF, 0x0080, 0x0000, 0x8001, 0xFFFF, 0x0080, 0x0000, 0x8001, 0xFFFF, 0x0080, 0x0000,
+  0x8001, 0xFFFF, 0x0080, 0x0000, 0x8001, 0xFFFF, 0x0080, 0x0000, 0x8001, 0xFFFF, 0x0080, 0x0000, 0x8001, 0xFFFF, 0x0080, 0x0000,
+  0x8001, 0xFFFF, 0x0080, 0x0000, 0x8001, 0xFFFF, 0x0080, 0x0000, 0x8001, 0xFFFF, 0x0080, 0x0000, 0x8001, 0xFFFF, 0x0080, 0x0000,
+  0x8001, 0xFFFF, 0x0080, 0x0000, 0x8001, 0xFFFF, 0x0080, 0x0000, 0x8001, 0xFFFF, 0x0080, 0x0000, 0x8001, 0xFFFF, 0x0080, 0x0000,
+  0x8001, 0xFFFF, 0x0080, 0x0000, 0x8001, 0xFFFF, 0x0080, 0x0000, 0x8001, 0xFFFF, 0x0080, 0x0000, 0x8001, 0xFFFF, 0x0080, 0x0000,
+  0x8001, 0xFFFF, 0x0080, 0x0000, 0x8001, 0xFFFF, 0x0080, 0x0000, 0x8001, 0xFFFF, 0x0080, 0x0000, 0x8001, 0xFFFF, 0x0080, 0x0000,
+  0x8001, 0xFFFF, 0x0080, 0x0000, 0x8001, 0xFFFF, 0x0009, 0x0000, 0x800B, 0x0820, 0x6182, 0xAAA4, 0xC305, 0xCB25, 0xCB25, 0xC305,
+  0xBAC4, 0x8A23, 0x5942, 0x1861, 0x0057, 0x0000, 0x800A, 0x0800, 0x1060, 0x38E2, 0x5942, 0x69C3, 0x79C3, 0x71C3, 0x6182, 0x38E1,
+  0x1040, 0x000B, 0x0000, 0x8001, 0xFFFF, 0x0009, 0x0000, 0x8001, 0xC305, 0x000B, 0xD345, 0x8003, 0xBAE4, 0x5962, 0x0820, 0x004F,
+  0x0000, 0x8006, 0x0820, 0x4922, 0xAAA4, 0xCB25, 0xD365, 0xDB45, 0x0008, 0xD345, 0x8001, 0x40E1, 0x000A, 0x0000, 0x8001, 0xFFFF,
+  0x0009, 0x0000, 0x000F, 0xD345, 0x8002, 0xB2C4, 0x30C1, 0x004B, 0x0000, 0x8002, 0x2081, 0xAAA4, 0x000E, 0xD345, 0x8001, 0x5962,
+  0x000A, 0x0000, 0x8001, 0xFFFF, 0x0009, 0x0000, 0x8009, 0x1861, 0x69A2, 0x4902, 0x30E1, 0x38C1, 0x4922, 0x71A3, 0xA2A4, 0xD325,
+  0x0005, 0xD345, 0x8005, 0xDB45, 0xD345, 0xD345, 0xCB25, 0x5142, 0x0047, 0x0000, 0x8002, 0x2081, 0xBAE4, 0x000B, 0xD345, 0x8005,
+  0xD325, 0xCB45, 0xD325, 0xCB25, 0x71C3, 0x000B, 0x0000, 0x8001, 0xFFFF, 0x0012, 0x0000, 0x8002, 0x1040, 0x71C3, 0x0008, 0xD345,
+  0x8002, 0xCB25, 0x4922, 0x0043, 0x0000, 0x8002, 0x0820, 0xAAA4, 0x0008, 0xD345, 0x8004, 0xBAE4, 0x71C3, 0x28A1, 0x0820, 0x0011,
+  0x0000, 0x8001, 0xFFFF, 0x0015, 0x0000, 0x8002, 0x40E1, 0xCB25, 0x0004, 0xD345, 0x8005, 0xDB45, 0xD345, 0xD345, 0xC305, 0x28A1,
+  0x0040, 0x0000, 0x8001, 0x6182, 0x0007, 0xD345, 0x8002, 0xBAE4, 0x4102, 0x0016, 0x0000, 0x8001, 0xFFFF, 0x0017, 0x0000, 0x8001,
+  0x4922, 0x0005, 0xD345, 0x8005, 0xDB45, 0xD345, 0xD345, 0xAAA4, 0x0820, 0x003C, 0x0000, 0x8002, 0x1840, 0xC305, 0x0006, 0xD345,
+  0x8002, 0xB2A4, 0x1861, 0x0018, 0x0000, 0x8001, 0xFFFF, 0x0019, 0x0000, 0x8001, 0x9243, 0x0008, 0xD345, 0x8001, 0x69A2, 0x003A,
+  0x0000, 0x8001, 0x71C3, 0x0007, 0xD345, 0x8001, 0x30C1, 0x001A, 0x0000, 0x8001, 0xFFFF, 0x001A, 0x0000, 0x8001, 0x30C1, 0x0008,
+  0xD345, 0x8002, 0xCB25, 0x28A1, 0x0036, 0x0000, 0x8002, 0x1861, 0xC305, 0x0006, 0xD345, 0x8001, 0xA284, 0x001C, 0x0000, 0x8001,
+  0xFFFF, 0x001C, 0x0000, 0x8001, 0xAAA4, 0x0008, 0xD345, 0x8002, 0xA284, 0x0820, 0x0033, 0x0000, 0x8002, 0x79E3, 0xDB45, 0x0006,
+  0xD345, 0x8001, 0x6182, 0x001D, 0x0000, 0x8001, 0xFFFF, 0x001D, 0x0000, 0x8001, 0x6162, 0x0009, 0xD345, 0x8001, 0x6182, 0x0030,
+  0x0000, 0x8002, 0x38E1, 0xCB25, 0x0007, 0xD345, 0x8001, 0x28A1, 0x001E, 0x0000, 0x8001, 0xFFFF, 0x001E, 0x0000, 0x8002, 0x2081,
+  0xCB25, 0x0008, 0xD345, 0x8002, 0xCB25, 0x38E1, 0x000E, 0x0000, 0x8003, 0x0820, 0x1861, 0x1860, 0x0003, 0x0000, 0x800A, 0x1040,
+  0x0000, 0x1040, 0x1041, 0x0000, 0x0000, 0x1840, 0x0000, 0x0000, 0x0820, 0x000E, 0x0000, 0x8002, 0x28A1, 0xBAE5, 0x0007, 0xD345,
+  0x8002, 0xC305, 0x0820, 0x001F, 0x0000, 0x8001, 0xFFFF, 0x0020, 0x0000, 0x8001, 0xAAA4, 0x0009, 0xD345, 0x8002, 0xBAE4, 0x38E2,
+  0x0009, 0x0000, 0x8003, 0x1040, 0xAA84, 0xD365, 0x0003, 0xD345, 0x8002, 0xCB25, 0xCB25, 0x000B, 0xD345, 0x8003, 0xD325, 0x8203,
+  0x0820, 0x0009, 0x0000, 0x8002, 0x4102, 0xBAE4, 0x0008, 0xD345, 0x8001, 0xAA84, 0x0021, 0x0000, 0x8001, 0xFFFF, 0x0021, 0x0000,
+  0x8001, 0x6182, 0x000B, 0xD345, 0x8008, 0xBAE4, 0x8203, 0x5142, 0x4102, 0x4101, 0x5942, 0x8A23, 0xCB25, 0x0016, 0xD345, 0x8002,
+  0x9A64, 0x1860, 0x0003, 0x0000, 0x8003, 0x1040, 0x4922, 0xA284, 0x000A, 0xD345, 0x8001, 0x79E3, 0x0022, 0x0000, 0x8001, 0xFFFF,
+  0x0022, 0x0000, 0x8002, 0x1861, 0xCB25, 0x002A, 0xD345, 0x8004, 0xCB25, 0xD345, 0xD345, 0xDB45, 0x000A, 0xD345, 0x8001, 0x38E1,
+  0x0023, 0x0000, 0x8001, 0xFFFF, 0x0024, 0x0000, 0x8001, 0x81E3, 0x0035, 0xD345, 0x8002, 0xC305, 0x1040, 0x0024, 0x0000, 0x8001,
+  0xFFFF, 0x0025, 0x0000, 0x8002, 0x1861, 0xBAE4, 0x0032, 0xD345, 0x8001, 0x79E3, 0x0026, 0x0000, 0x8001, 0xFFFF, 0x0027, 0x0000,
+  0x8003, 0x4101, 0xC305, 0xDB45, 0x002D, 0xD345, 0x8002, 0xBAE4, 0x1861, 0x0027, 0x0000, 0x8001, 0xFFFF, 0x0029, 0x0000, 0x8002,
+  0x30C1, 0xB2C4, 0x002A, 0xD345, 0x8002, 0xB2C4, 0x28A1, 0x0029, 0x0000, 0x8001, 0xFFFF, 0x002B, 0x0000, 0x8001, 0x9244, 0x0028,
+  0xD345, 0x8001, 0x4102, 0x002B, 0x0000, 0x8001, 0xFFFF, 0x0028, 0x0000, 0x8003, 0x0820, 0x5142, 0xCB25, 0x002A, 0xD345, 0x8001,
+  0x71C3, 0x002A, 0x0000, 0x8001, 0xFFFF, 0x0026, 0x0000, 0x8002, 0x2081, 0xC304, 0x002F, 0xD345, 0x8002, 0x9243, 0x0820, 0x0027,
+  0x0000, 0x8001, 0xFFFF, 0x0026, 0x0000, 0x0033, 0xD345, 0x0027, 0x0000, 0x8001, 0xFFFF, 0x0026, 0x0000, 0x8001, 0xCB25, 0x0032,
+  0xD345, 0x8001, 0x0820, 0x0026, 0x0000, 0x8001, 0xFFFF, 0x0026, 0x0000, 0x8002, 0x0820, 0xBAC4, 0x000A, 0xD345, 0x8002, 0x71C3,
+  0xA284, 0x0018, 0xD345, 0x8003, 0x30A1, 0x8223, 0xDB45, 0x0009, 0xD345, 0x8001, 0xBAE4, 0x0027, 0x0000, 0x8001, 0xFFFF, 0x0028,
+  0x0000, 0x8002, 0x2081, 0xA284, 0x0005, 0xD345, 0x8005, 0xC2E5, 0x5142, 0x0000, 0x0000, 0x5962, 0x0018, 0xD345, 0x8004, 0x0000,
+  0x0000, 0x1861, 0xA284, 0x0006, 0xD345, 0x8002, 0xCB25, 0x5962, 0x0028, 0x0000, 0x8001, 0xFFFF, 0x002A, 0x0000, 0x8005, 0x0820,
+  0x28A1, 0x38E1, 0x1861, 0x0820, 0x0004, 0x0000, 0x8001, 0x4102, 0x0018, 0xD345, 0x0005, 0x0000, 0x8005, 0x1861, 0x4101, 0x4922,
+  0x30C1, 0x1040, 0x002A, 0x0000, 0x8001, 0xFFFF, 0x0033, 0x0000, 0x8001, 0x1840, 0x0017, 0xD345, 0x8001, 0xC305, 0x0034, 0x0000,
+  0x8001, 0xFFFF, 0x0034, 0x0000, 0x0017, 0xD345, 0x8001, 0x9243, 0x0034, 0x0000, 0x8001, 0xFFFF, 0x0034, 0x0000, 0x8001, 0xA284,
+  0x0016, 0xD345, 0x8001, 0x38E1, 0x0034, 0x0000, 0x8001, 0xFFFF, 0x0034, 0x0000, 0x8001, 0x30C1, 0x0016, 0xD345, 0x0035, 0x0000,
+  0x8001, 0xFFFF, 0x0035, 0x0000, 0x8001, 0xCB25, 0x0014, 0xD345, 0x8001, 0x79E3, 0x0035, 0x0000, 0x8001, 0xFFFF, 0x0035, 0x0000,
+  0x8001, 0x4922, 0x0014, 0xD345, 0x0036, 0x0000, 0x8001, 0xFFFF, 0x0036, 0x0000, 0x8001, 0xD325, 0x0012, 0xD345, 0x8001, 0x69A2,
+  0x0036, 0x0000, 0x8001, 0xFFFF, 0x0036, 0x0000, 0x8002, 0x4942, 0xDB45, 0x0011, 0xD345, 0x0037, 0x0000, 0x8001, 0xFFFF, 0x0037,
+  0x0000, 0x8002, 0xCB25, 0xDB45, 0x000F, 0xD345, 0x8001, 0x4102, 0x0037, 0x0000, 0x8001, 0xFFFF, 0x0037, 0x0000, 0x8001, 0x5962,
+  0x000F, 0xD345, 0x8001, 0xC305, 0x0038, 0x0000, 0x8001, 0xFFFF, 0x0038, 0x0000, 0x000F, 0xD345, 0x8001, 0x38E1, 0x0038, 0x0000,
+  0x8001, 0xFFFF, 0x0038, 0x0000, 0x8001, 0x9243, 0x000D, 0xD345, 0x8001, 0xCB25, 0x0039, 0x0000, 0x8001, 0xFFFF, 0x0038, 0x0000,
+  0x8001, 0x28A1, 0x000C, 0xD345, 0x8002, 0xDB45, 0x79E3, 0x0039, 0x0000, 0x8001, 0xFFFF, 0x0039, 0x0000, 0x000D, 0xD345, 0x8001,
+  0x28A1, 0x0039, 0x0000, 0x8001, 0xFFFF, 0x0039, 0x0000, 0x8001, 0xCB25, 0x000C, 0xD345, 0x8001, 0x0820, 0x0039, 0x0000, 0x8001,
+  0xFFFF, 0x0039, 0x0000, 0x8001, 0xC305, 0x000B, 0xD345, 0x8002, 0xDB45, 0x0820, 0x0039, 0x0000, 0x8001, 0xFFFF, 0x0039, 0x0000,
+  0x000D, 0xD345, 0x8001, 0x1040, 0x0039, 0x0000, 0x8001, 0xFFFF, 0x0038, 0x0000, 0x8001, 0x0820, 0x000D, 0xD345, 0x8001, 0x4102,
+  0x0039, 0x0000, 0x8001, 0xFFFF, 0x0038, 0x0000, 0x8001, 0x6182, 0x000D, 0xD345, 0x8001, 0x9A63, 0x0039, 0x0000, 0x8001, 0xFFFF,
+  0x0038, 0x0000, 0x8001, 0xC305, 0x000D, 0xD345, 0x8001, 0xCB25, 0x0039, 0x0000, 0x8001, 0xFFFF, 0x0037, 0x0000, 0x8001, 0x0820,
+  0x000D, 0xD345, 0x8003, 0xDB45, 0xD345, 0x2061, 0x0038, 0x0000, 0x8001, 0xFFFF, 0x0037, 0x0000, 0x8001, 0x2081, 0x000F, 0xD345,
+  0x8001, 0x71C3, 0x0038, 0x0000, 0x8001, 0xFFFF, 0x0038, 0x0000, 0x000F, 0xD345, 0x8001, 0x4922, 0x0038, 0x0000, 0x8001, 0xFFFF,
+  0x0038, 0x0000, 0x8001, 0x71C3, 0x000E, 0xD345, 0x0039, 0x0000, 0x8001, 0xFFFF, 0x0038, 0x0000, 0x8001, 0x2081, 0x000D, 0xD345,
+  0x8001, 0xBAE4, 0x0039, 0x0000, 0x8001, 0xFFFF, 0x0039, 0x0000, 0x000D, 0xD345, 0x8001, 0x5942, 0x0039, 0x0000, 0x8001, 0xFFFF,
+  0x0039, 0x0000, 0x8001, 0x2081, 0x000B, 0xD345, 0x8001, 0x9A64, 0x003A, 0x0000, 0x8001, 0xFFFF, 0x003A, 0x0000, 0x8002, 0x1861,
+  0xCB25, 0x0008, 0xD345, 0x8001, 0x9A64, 0x003B, 0x0000, 0x8001, 0xFFFF, 0x003C, 0x0000, 0x8008, 0x28A1, 0x71C3, 0x9243, 0x9A64,
+  0x8A23, 0x71C3, 0x4101, 0x1841, 0x003C, 0x0000, 0x8001, 0xFFFF, 0x0080, 0x0000, 0x8001, 0xFFFF, 0x0080, 0x0000, 0x8001, 0xFFFF,
+  0x0080, 0x0000, 0x8001, 0xFFFF, 0x0080, 0x0000, 0x8001, 0xFFFF, 0x0080, 0x0000, 0x8001, 0xFFFF, 0x0080, 0x0000, 0x8001, 0xFFFF,
+  0x0080, 0x0000, 0x8001, 0xFFFF, 0x0080, 0x0000, 0x8001, 0xFFFF, 0x0080, 0x0000, 0x8001, 0xFFFF, 0x0080, 0x0000, 0x8001, 0xFFFF,
+  0x0080, 0x0000, 0x8001, 0xFFFF, 0x0080, 0x0000, 0x8001, 0xFFFF, 0x0080, 0x0000, 0x8001, 0xFFFF, 0x0080, 0x0000, 0x8001, 0xFFFF,
+  0x0080, 0x0000, 0x8001, 0xFFFF, 0x0080, 0x0000, 0x8001, 0xFFFF, 0x0080, 0x0000, 0x8001, 0xFFFF, 0x0080, 0x0000, 0x8001, 0xFFFF,
+  0x0080, 0x0000, 0x8001, 0xFFFF, 0x0080, 0x0000, 0x8001, 0xFFFF, 0x0080, 0x0000, 0x8001, 0xFFFF, 0x0080, 0x0000, 0x8001, 0xFFFF,
+  0x0080, 0x0000, 0x8001, 0xFFFF, 0x0080, 0x0000, 0x8001, 0xFFFF, 0x0080, 0x0000, 0x8001, 0xFFFF, 0x0080, 0x0000, 0x8001, 0xFFFF,
+  0x0080, 0x0000, 0x8001, 0xFFFF, 0x0080, 0x0000, 0x8001, 0xFFFF, 0x0080, 0x0000, 0x8001, 0xFFFF, 0x0080, 0x0000, 0x8001, 0xFFFF,
+  0x0080, 0x0000, 0x8001, 0xFFFF, 0x0080, 0x0000, 0x8001, 0xFFFF, 0x0080, 0x0000, 0x8001, 0xFFFF, 0x0080, 0x0000, 0x0082, 0xFFFF,
+};
+
@@ -0,0 +1,540 @@
+// Text_icon_ili.h
+// Made by Bitmaps/lvimg2ili.py from Text_icon.h; do not edit.
+// 91x91 pixels, 112 colors, top row first, standard RGB565
+#include <stdint.h>
+
+#define TEXT_ICON_W 91
+#define TEXT_ICON_H 91
+
+// ILI9341_DrawBitmapPal8(x, y, Text_icon_pal, Text_icon_pal8, 91, 91);
+static const uint16_t Text_icon_pal[112] = {
+  0x0000, 0xFFFF, 0xFFDF, 0x0020, 0xFFBF, 0xEF5D, 0x1082, 0x18A3, 0xBDB7, 0x8C51, 0xD69A, 0x2945, 0x10A2, 0x9CD3, 0xE71C, 0x6B4D,
+  0x528A, 0x632C, 0x0821, 0xB576, 0x630C, 0xAD75, 0x1062, 0x3166, 0xBDD7, 0x0842, 0x18C3, 0x3186, 0xF79E, 0x0843, 0xA514, 0xB5B6,
+  0x0820, 0x18E3, 0x2925, 0xC5F8, 0xF7BE, 0xDEBB, 0xD67A, 0xCE79, 0xB596, 0x738E, 0x20E4, 0xDEDB, 0x0862, 0x52AA, 0xBDF7, 0xEF3D,
+  0x0863, 0x1043, 0x736E, 0xCE59, 0x2104, 0x7BAF, 0xA4F4, 0x6B6D, 0xE6FC, 0x2965, 0xFF9F, 0x0841, 0x2124, 0x9492, 0x5AAB, 0x73AE,
+  0x39C7, 0x8410, 0xAD55, 0xF77E, 0xD6BA, 0xDEFB, 0xEF7D, 0xC618, 0x4A49, 0x6B2D, 0x8C31, 0x5ACB, 0xCE39, 0x8430, 0xE73C, 0x18A2,
+  0xA535, 0x4A69, 0x39E7, 0x62EC, 0x41E8, 0x9CF3, 0x9CB3, 0x8C71, 0x7BCF, 0x10A3, 0x73AF, 0x7BAE, 0x9CD5, 0x1083, 0x9CD4, 0xFFBE,
+  0xE73D, 0x5AAA, 0x526A, 0x2924, 0x0881, 0x0800, 0x39A7, 0xA4D4, 0x2966, 0xE6FB, 0x31A6, 0xBD97, 0x8C72, 0x9472, 0x83F0, 0x4A29,
+};
+
+static const uint8_t Text_icon_pal8[8281] = {
+  0x01, 0x5C, 0x19, 0x30, 0x19, 0x1D, 0x2C, 0x31, 0x19, 0x1D, 0x2C, 0x1D, 0x19, 0x30, 0x31, 0x19,
+  0x1D, 0x2C, 0x1D, 0x19, 0x30, 0x31, 0x19, 0x1D, 0x2C, 0x1D, 0x19, 0x30, 0x31, 0x19, 0x1D, 0x2C,
+  0x1D, 0x19, 0x30, 0x31, 0x19, 0x1D, 0x2C, 0x1D, 0x19, 0x1D, 0x2C, 0x1D, 0x19, 0x30, 0x31, 0x19,
+  0x1D, 0x2C, 0x1D, 0x19, 0x30, 0x31, 0x19, 0x1D, 0x2C, 0x1D, 0x19, 0x30, 0x31, 0x19, 0x5D, 0x5E,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x5F, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x23, 0x01, 0x02, 0x01, 0x01,
+  0x02, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x02,
+  0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x03, 0x00, 0x0C, 0x28, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01, 0x04, 0x01,
+  0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01,
+  0x01, 0x05, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00,
+  0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
+  0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00,
+  0x07, 0x1F, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x02, 0x01, 0x01, 0x04,
+  0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x05, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x08, 0x01, 0x02, 0x02,
+  0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01,
+  0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+  0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x08, 0x01, 0x01, 0x01, 0x02, 0x04, 0x01, 0x01, 0x02,
+  0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01,
+  0x01, 0x01, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00,
+  0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x03,
+  0x00, 0x07, 0x1F, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01,
+  0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x05, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00,
+  0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x1A, 0x08, 0x01, 0x02,
+  0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x02, 0x24, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01,
+  0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x05, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00,
+  0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+  0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+  0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0C, 0x08, 0x01, 0x02, 0x01, 0x01, 0x02, 0x02, 0x01,
+  0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x04, 0x01, 0x01, 0x04,
+  0x01, 0x01, 0x01, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+  0x03, 0x00, 0x07, 0x1F, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02,
+  0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01, 0x01, 0x05, 0x00,
+  0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x06, 0x16, 0x06, 0x16, 0x06, 0x16,
+  0x06, 0x06, 0x16, 0x06, 0x16, 0x06, 0x16, 0x06, 0x16, 0x06, 0x16, 0x06, 0x16, 0x06, 0x16, 0x06,
+  0x16, 0x06, 0x16, 0x06, 0x16, 0x06, 0x16, 0x06, 0x16, 0x06, 0x06, 0x16, 0x06, 0x16, 0x06, 0x16,
+  0x06, 0x06, 0x06, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x08, 0x01,
+  0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02,
+  0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x04, 0x01, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1B, 0x50, 0x28, 0x15, 0x13, 0x15, 0x13, 0x15, 0x13, 0x15, 0x13, 0x15, 0x13,
+  0x15, 0x13, 0x15, 0x13, 0x15, 0x13, 0x15, 0x13, 0x15, 0x13, 0x15, 0x15, 0x13, 0x15, 0x13, 0x15,
+  0x13, 0x15, 0x13, 0x15, 0x13, 0x15, 0x42, 0x13, 0x15, 0x13, 0x15, 0x13, 0x15, 0x28, 0x36, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x08, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04,
+  0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01,
+  0x02, 0x02, 0x01, 0x01, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x47, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x1F, 0x01, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01,
+  0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01, 0x05,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x21, 0x0A, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x1C, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x08,
+  0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01,
+  0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x02, 0x01, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x48, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x1A, 0x1F, 0x01, 0x01, 0x3A, 0x01, 0x01,
+  0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02,
+  0x01, 0x01, 0x04, 0x01, 0x01, 0x05, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x07, 0x08, 0x01, 0x02, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01,
+  0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x04, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01,
+  0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C,
+  0x08, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04,
+  0x01, 0x01, 0x01, 0x24, 0x01, 0x01, 0x04, 0x02, 0x01, 0x01, 0x01, 0x05, 0x00, 0x00, 0x00, 0x03,
+  0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x07, 0x1F, 0x01, 0x01, 0x02, 0x02,
+  0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x04, 0x01, 0x01,
+  0x04, 0x01, 0x01, 0x01, 0x04, 0x01, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x06, 0x14, 0x0F, 0x0F, 0x0F, 0x37, 0x49, 0x37, 0x0F, 0x0F, 0x0F, 0x0F, 0x32, 0x11, 0x32, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x32, 0x11, 0x32, 0x0F, 0x0F, 0x0F, 0x0F, 0x32, 0x11, 0x0F, 0x37, 0x0F, 0x0F,
+  0x0F, 0x32, 0x0F, 0x0F, 0x37, 0x0F, 0x0F, 0x0F, 0x37, 0x0F, 0x37, 0x14, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x08, 0x01, 0x02, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02,
+  0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01, 0x04, 0x01,
+  0x01, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x4A, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0C, 0x08, 0x01, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01,
+  0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01, 0x05, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0x00, 0x3C, 0x38, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x02, 0x01,
+  0x01, 0x02, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01,
+  0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x02, 0x01,
+  0x01, 0x01, 0x05, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x07, 0x1F, 0x01, 0x01, 0x01,
+  0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x02, 0x01,
+  0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x01, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+  0x00, 0x3D, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0D, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x07, 0x08, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01,
+  0x01, 0x04, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04,
+  0x02, 0x01, 0x05, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x4B, 0x10,
+  0x2D, 0x10, 0x2D, 0x10, 0x2D, 0x10, 0x10, 0x2D, 0x10, 0x61, 0x10, 0x2D, 0x10, 0x10, 0x10, 0x10,
+  0x3E, 0x10, 0x10, 0x2D, 0x10, 0x10, 0x10, 0x3E, 0x51, 0x3E, 0x10, 0x10, 0x10, 0x10, 0x3E, 0x51,
+  0x3E, 0x10, 0x10, 0x10, 0x10, 0x3E, 0x2D, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+  0x00, 0x0C, 0x08, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x04,
+  0x01, 0x01, 0x04, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x05, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x07, 0x1F, 0x01, 0x01,
+  0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x24, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01,
+  0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x07, 0x08, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04,
+  0x01, 0x01, 0x02, 0x04, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01,
+  0x01, 0x04, 0x01, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x16, 0x21,
+  0x2A, 0x21, 0x2A, 0x1A, 0x2A, 0x21, 0x21, 0x21, 0x21, 0x2A, 0x1A, 0x2A, 0x21, 0x21, 0x21, 0x21,
+  0x2A, 0x1A, 0x21, 0x2A, 0x21, 0x07, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+  0x00, 0x00, 0x0C, 0x18, 0x01, 0x02, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01,
+  0x04, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x46, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x28, 0x23, 0x2E, 0x23, 0x2E, 0x18, 0x23,
+  0x23, 0x2E, 0x23, 0x2E, 0x23, 0x2E, 0x23, 0x23, 0x23, 0x2E, 0x23, 0x2E, 0x18, 0x23, 0x2E, 0x23,
+  0x18, 0x49, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x07, 0x1F, 0x01,
+  0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01, 0x04, 0x01,
+  0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x1A, 0x4C, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x22, 0x00, 0x00,
+  0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x07, 0x08, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01,
+  0x01, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x02,
+  0x01, 0x01, 0x02, 0x01, 0x05, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x33, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x0C, 0x08, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x04, 0x01, 0x01, 0x04, 0x01,
+  0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x05,
+  0x00, 0x03, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x52, 0x38, 0x02, 0x1C, 0x02, 0x02, 0x1C,
+  0x04, 0x02, 0x04, 0x24, 0x02, 0x02, 0x1C, 0x04, 0x01, 0x04, 0x24, 0x02, 0x02, 0x04, 0x1C, 0x01,
+  0x01, 0x1C, 0x48, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x07, 0x1F,
+  0x01, 0x04, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01, 0x3A, 0x01, 0x01, 0x02,
+  0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x05, 0x00, 0x00, 0x00, 0x00, 0x03,
+  0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+  0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+  0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x07, 0x08, 0x01, 0x01, 0x01, 0x02, 0x04,
+  0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x1C, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x1C, 0x01, 0x01,
+  0x02, 0x02, 0x01, 0x01, 0x01, 0x05, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00,
+  0x00, 0x00, 0x20, 0x00, 0x0C, 0x1F, 0x01, 0x01, 0x01, 0x24, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01,
+  0x3A, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01,
+  0x05, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+  0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00,
+  0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x07,
+  0x08, 0x01, 0x02, 0x04, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x05, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x08, 0x01, 0x02, 0x01, 0x3D,
+  0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+  0x0D, 0x0D, 0x0D, 0x3D, 0x25, 0x01, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x1F, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34,
+  0x01, 0x05, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+  0x07, 0x08, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x43, 0x05, 0x00, 0x03, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0C, 0x08, 0x01, 0x01, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
+  0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00,
+  0x00, 0x03, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x18, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x2F, 0x05, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+  0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+  0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+  0x00, 0x0C, 0x28, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+  0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x1C, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x47, 0x01, 0x01,
+  0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00,
+  0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x05, 0x01, 0x62, 0x3C, 0x22, 0x63, 0x0B, 0x22, 0x0B,
+  0x3C, 0x17, 0x21, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+  0x00, 0x00, 0x00, 0x00, 0x34, 0x0B, 0x0B, 0x0B, 0x0B, 0x22, 0x0B, 0x0B, 0x22, 0x0B, 0x0B, 0x0B,
+  0x22, 0x0B, 0x0B, 0x22, 0x0B, 0x0B, 0x0B, 0x22, 0x0B, 0x0B, 0x22, 0x0B, 0x22, 0x0B, 0x22, 0x0B,
+  0x0B, 0x22, 0x0B, 0x22, 0x0B, 0x3C, 0x22, 0x4D, 0x01, 0x01, 0x01, 0x26, 0x00, 0x00, 0x03, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x05, 0x01, 0x01, 0x0A, 0x27, 0x26, 0x27, 0x0A, 0x26, 0x27, 0x25, 0x29, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x3B, 0x53, 0x33,
+  0x26, 0x0A, 0x0A, 0x26, 0x27, 0x0A, 0x0A, 0x27, 0x26, 0x0A, 0x0A, 0x27, 0x0A, 0x0A, 0x27, 0x26,
+  0x0A, 0x0A, 0x27, 0x0A, 0x0A, 0x27, 0x26, 0x0A, 0x0A, 0x27, 0x26, 0x0A, 0x0A, 0x27, 0x0A, 0x0A,
+  0x33, 0x2B, 0x01, 0x01, 0x02, 0x01, 0x48, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x1F, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x04, 0x01,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x02,
+  0x01, 0x01, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x29, 0x4E, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x13, 0x64, 0x65, 0x00, 0x00, 0x03,
+  0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x05, 0x01, 0x02, 0x02, 0x01, 0x02, 0x04, 0x01, 0x01, 0x01, 0x29, 0x00, 0x00,
+  0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x01, 0x01, 0x02, 0x02,
+  0x01, 0x01, 0x43, 0x27, 0x25, 0x0A, 0x25, 0x2B, 0x44, 0x26, 0x2B, 0x25, 0x0A, 0x44, 0x25, 0x44,
+  0x26, 0x2B, 0x25, 0x0A, 0x0A, 0x2B, 0x25, 0x0A, 0x25, 0x25, 0x44, 0x0A, 0x2B, 0x25, 0x26, 0x2B,
+  0x25, 0x25, 0x0A, 0x50, 0x54, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x01,
+  0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x4B, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x02, 0x01, 0x3D, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01,
+  0x04, 0x01, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x33, 0x01,
+  0x01, 0x01, 0x04, 0x01, 0x01, 0x01, 0x02, 0x01, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+  0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+  0x00, 0x00, 0x03, 0x00, 0x05, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x01, 0x01, 0x66, 0x00, 0x00,
+  0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x3B, 0x32, 0x1C, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01,
+  0x04, 0x01, 0x01, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+  0x01, 0x02, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x40, 0x42, 0x01, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01, 0x55, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x34, 0x0F, 0x14, 0x11, 0x14, 0x11, 0x14, 0x11,
+  0x14, 0x11, 0x14, 0x11, 0x14, 0x11, 0x14, 0x11, 0x14, 0x11, 0x14, 0x11, 0x14, 0x11, 0x14, 0x11,
+  0x14, 0x11, 0x14, 0x11, 0x14, 0x11, 0x14, 0x11, 0x14, 0x11, 0x14, 0x11, 0x14, 0x11, 0x14, 0x49,
+  0x1A, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x05, 0x01, 0x01, 0x01, 0x02, 0x02,
+  0x01, 0x01, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x2F, 0x01, 0x01, 0x01, 0x01,
+  0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x02, 0x01, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+  0x00, 0x00, 0x0C, 0x4C, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x36, 0x3B, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x06, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x40, 0x13, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x02, 0x01,
+  0x01, 0x02, 0x02, 0x01, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x17, 0x01, 0x01,
+  0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x02, 0x01,
+  0x01, 0x02, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02,
+  0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x2B, 0x34, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00,
+  0x05, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4D, 0x1C, 0x01,
+  0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x0D,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x67, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x58, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x01, 0x01, 0x01, 0x01,
+  0x04, 0x01, 0x01, 0x00, 0x00, 0x00, 0x07, 0x4C, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01,
+  0x01, 0x02, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x1E, 0x00, 0x00, 0x03, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x00, 0x06, 0x1A, 0x07, 0x0C, 0x07, 0x0C, 0x07, 0x0C, 0x07, 0x07, 0x0C,
+  0x07, 0x0C, 0x07, 0x0C, 0x07, 0x1A, 0x4F, 0x59, 0x4F, 0x1A, 0x4F, 0x59, 0x1A, 0x07, 0x0C, 0x07,
+  0x1A, 0x07, 0x0C, 0x07, 0x07, 0x0C, 0x07, 0x1A, 0x07, 0x0C, 0x1A, 0x06, 0x00, 0x00, 0x03, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01, 0x2F, 0x34,
+  0x41, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x04, 0x01, 0x01, 0x02,
+  0x02, 0x01, 0x01, 0x04, 0x01, 0x1E, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
+  0x00, 0x05, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02,
+  0x01, 0x01, 0x04, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01,
+  0x36, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x01, 0x02, 0x01,
+  0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01,
+  0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01, 0x55, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x1B, 0x17, 0x1B, 0x1B, 0x17, 0x17, 0x1B, 0x17, 0x39,
+  0x1B, 0x1B, 0x17, 0x17, 0x1B, 0x17, 0x39, 0x1B, 0x1B, 0x17, 0x39, 0x1B, 0x1B, 0x17, 0x17, 0x1B,
+  0x17, 0x39, 0x1B, 0x17, 0x68, 0x17, 0x1B, 0x17, 0x39, 0x1B, 0x17, 0x1B, 0x34, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x05, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04,
+  0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x04, 0x02, 0x01,
+  0x01, 0x02, 0x01, 0x01, 0x02, 0x01, 0x1E, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12,
+  0x29, 0x2B, 0x0E, 0x45, 0x0E, 0x0E, 0x45, 0x0E, 0x0E, 0x0E, 0x38, 0x0E, 0x0E, 0x45, 0x0E, 0x0E,
+  0x0E, 0x38, 0x0E, 0x0E, 0x0E, 0x38, 0x0E, 0x0E, 0x45, 0x0E, 0x0E, 0x0E, 0x38, 0x0E, 0x0E, 0x69,
+  0x0E, 0x0E, 0x0E, 0x38, 0x0E, 0x0E, 0x0E, 0x0A, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x05, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01,
+  0x04, 0x01, 0x01, 0x02, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x01,
+  0x01, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x26, 0x21, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x05, 0x01, 0x02,
+  0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x02, 0x01,
+  0x01, 0x04, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x0D, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0x00, 0x2A, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x08, 0x06,
+  0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x01, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01,
+  0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x04,
+  0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x1E, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00,
+  0x00, 0x6A, 0x42, 0x2E, 0x28, 0x08, 0x18, 0x08, 0x28, 0x18, 0x18, 0x28, 0x08, 0x18, 0x08, 0x28,
+  0x18, 0x08, 0x1F, 0x08, 0x18, 0x18, 0x13, 0x18, 0x08, 0x1F, 0x08, 0x08, 0x18, 0x28, 0x08, 0x18,
+  0x1F, 0x6B, 0x18, 0x18, 0x28, 0x08, 0x08, 0x18, 0x3D, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x05, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x04, 0x01, 0x01, 0x04, 0x01,
+  0x01, 0x02, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x02, 0x24, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01,
+  0x04, 0x01, 0x1E, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x05, 0x01,
+  0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02,
+  0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x36, 0x00, 0x00,
+  0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x01, 0x02, 0x01, 0x01, 0x02, 0x02,
+  0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01,
+  0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x12, 0x00, 0x00,
+  0x00, 0x03, 0x00, 0x00, 0x2F, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01,
+  0x02, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01,
+  0x01, 0x02, 0x01, 0x1E, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x32, 0x5A,
+  0x5B, 0x5A, 0x3F, 0x3F, 0x35, 0x29, 0x3F, 0x35, 0x3F, 0x35, 0x29, 0x35, 0x29, 0x3F, 0x35, 0x3F,
+  0x35, 0x29, 0x35, 0x29, 0x35, 0x29, 0x2A, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+  0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01,
+  0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x1E, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x27, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x18, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x05, 0x01, 0x02, 0x04, 0x01, 0x01,
+  0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02,
+  0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x39, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x01,
+  0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x1C, 0x0B, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x01, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x04, 0x01,
+  0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02,
+  0x02, 0x01, 0x01, 0x01, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x57, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x5B, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x3A,
+  0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x36,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+  0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+  0x06, 0x06, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+  0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x05, 0x01, 0x01, 0x04, 0x01,
+  0x01, 0x02, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01,
+  0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00,
+  0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02,
+  0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01,
+  0x01, 0x04, 0x01, 0x01, 0x01, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00,
+  0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x03, 0x00,
+  0x00, 0x2F, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01,
+  0x02, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x01,
+  0x1E, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00,
+  0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x01, 0x01, 0x01,
+  0x02, 0x01, 0x01, 0x04, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01,
+  0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x1E, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x05, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01,
+  0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04,
+  0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x05, 0x01, 0x02, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02,
+  0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01,
+  0x01, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+  0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x01, 0x01,
+  0x01, 0x02, 0x02, 0x01, 0x02, 0x24, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02,
+  0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x01, 0x36, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
+  0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x05, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04,
+  0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01,
+  0x02, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+  0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+  0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x05, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01,
+  0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x24, 0x01, 0x01, 0x02, 0x02,
+  0x01, 0x01, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4E, 0x01,
+  0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01,
+  0x01, 0x04, 0x01, 0x01, 0x02, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01, 0x01, 0x02, 0x3B, 0x00,
+  0x03, 0x03, 0x12, 0x03, 0x12, 0x03, 0x12, 0x03, 0x03, 0x12, 0x03, 0x12, 0x03, 0x12, 0x03, 0x12,
+  0x03, 0x12, 0x03, 0x12, 0x03, 0x12, 0x03, 0x12, 0x03, 0x12, 0x03, 0x12, 0x03, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x03,
+  0x12, 0x03, 0x12, 0x03, 0x03, 0x03, 0x00, 0x00, 0x06, 0x01, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01,
+  0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01, 0x04,
+  0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x2B, 0x41, 0x09, 0x09, 0x09, 0x09, 0x09,
+  0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+  0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x6C, 0x4D, 0x17, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x2D, 0x6D, 0x09, 0x09, 0x4A, 0x09,
+  0x09, 0x4A, 0x41, 0x24, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01,
+  0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01,
+  0x04, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x4E, 0x11, 0x12, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x03, 0x00, 0x00, 0x53, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x02, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04,
+  0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01,
+  0x01, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x02,
+  0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x02, 0x01,
+  0x01, 0x47, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0A, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02,
+  0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x04, 0x01, 0x01,
+  0x04, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02,
+  0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01,
+  0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01, 0x02, 0x01, 0x2F, 0x6E, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x3D, 0x01, 0x01, 0x01,
+  0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02,
+  0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01, 0x04, 0x01,
+  0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x1C, 0x01, 0x01, 0x02,
+  0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01, 0x04, 0x01,
+  0x01, 0x04, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01, 0x01, 0x05, 0x00, 0x00, 0x00, 0x00, 0x03,
+  0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x2A, 0x24, 0x01, 0x04, 0x01, 0x01, 0x01, 0x02, 0x01,
+  0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01,
+  0x02, 0x04, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x3A, 0x01, 0x01, 0x04, 0x02, 0x01, 0x01, 0x1C,
+  0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x3A, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01,
+  0x02, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01, 0x04,
+  0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+  0x00, 0x03, 0x00, 0x43, 0x01, 0x01, 0x01, 0x02, 0x04, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01,
+  0x04, 0x01, 0x01, 0x02, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01, 0x24, 0x01, 0x01, 0x04, 0x01,
+  0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01,
+  0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01,
+  0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x1C, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01,
+  0x04, 0x01, 0x01, 0x33, 0x34, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x4B, 0x01,
+  0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x02, 0x01,
+  0x01, 0x04, 0x01, 0x01, 0x02, 0x04, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02,
+  0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01,
+  0x01, 0x04, 0x01, 0x01, 0x02, 0x24, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01, 0x1C, 0x01, 0x01, 0x02,
+  0x02, 0x01, 0x01, 0x1C, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01, 0x01, 0x02,
+  0x37, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02,
+  0x01, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x04,
+  0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01,
+  0x02, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x04,
+  0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01,
+  0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x42, 0x6F, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01,
+  0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01,
+  0x02, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01,
+  0x01, 0x02, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01,
+  0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x02, 0x01,
+  0x01, 0x02, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x24, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0B, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04,
+  0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01,
+  0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04,
+  0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01,
+  0x01, 0x04, 0x01, 0x01, 0x04, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04,
+  0x01, 0x01, 0x02, 0x01, 0x01, 0x08, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01,
+  0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01,
+  0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02,
+  0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01,
+  0x04, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x01,
+  0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01,
+  0x01, 0x04, 0x41, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x05, 0x54,
+  0x00, 0x0D, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+};
+
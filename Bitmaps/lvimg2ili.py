@@ -0,0 +1,202 @@
+#!/usr/bin/env python3
+# lvimg2ili.py
+# Makes compressed copies of an LVGL true color image for the
+# ILI9341_DrawBitmapRLE(), ILI9341_DrawBitmapPal8() and
+# ILI9341_DrawBitmapPal4() drawing functions.
+# The input is a C file from the LVGL online image converter
+# (like Bitmaps/Call_icon.h); the pixels are taken from its
+# LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0 section, which
+# holds standard RGB565 colors, top row first.
+# usage: python3 lvimg2ili.py [--pal4 | --lvgl] Call_icon.h [more.h ...]
+# Each Name.h gives Name_ili.h next to it with
+#   NAME_W, NAME_H  size in pixels
+# and the smallest of
+#   Name_rle[]      packets for ILI9341_DrawBitmapRLE()
+#   Name_pal[]      palette for ILI9341_DrawBitmapPal8/4()
+#   Name_pal8[]     indices for ILI9341_DrawBitmapPal8() (256 colors or fewer)
+#   Name_pal4[]     indices for ILI9341_DrawBitmapPal4() (16 colors or fewer,
+#                   or any image with --pal4, which keeps the 16 most used
+#                   colors and maps the rest to the nearest one)
+# With --lvgl, Name.h gives Name_i8.h instead, with the image descriptor
+#   Name_i8         LV_IMG_CF_INDEXED_8BIT for lv_img_set_src()
+# which needs LV_IMG_CF_INDEXED 1 in lv_conf.h.  Its data is a palette of
+# 256 lv_color32_t and one index byte per pixel: 1024 + w*h bytes
+# instead of the 2*w*h of LV_IMG_CF_TRUE_COLOR.
+# The arrays are static, so include each header in one C file only.
+import os
+import re
+import sys
+
+SECTION = r'#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0(.*?)#endif'
+
+
+def read_image(path):
+    text = open(path).read()
+    name = re.search(r'const lv_img_dsc_t (\w+)', text).group(1)
+    w = int(re.search(r'\.header\.w = (\d+)', text).group(1))
+    h = int(re.search(r'\.header\.h = (\d+)', text).group(1))
+    data = re.search(SECTION, text, re.S).group(1)
+    data = re.sub(r'/\*.*?\*/', '', data, flags=re.S)
+    b = [int(v, 16) for v in re.findall(r'0x([0-9a-fA-F]{2})', data)]
+    pixels = [b[i] | (b[i+1] << 8) for i in range(0, len(b), 2)]
+    if len(pixels) != w*h:
+        sys.exit('%s: %d pixels, expected %d' % (path, len(pixels), w*h))
+    return name, w, h, pixels
+
+
+# 0nnn nnnn nnnn nnnn, c: n copies of c
+# 1nnn nnnn nnnn nnnn, c1..cn: n literal colors
+def rle(pixels):
+    out = []
+    lit = []
+
+    def flush_literal():
+        while lit:
+            n = min(len(lit), 0x7FFF)
+            out.append(0x8000 | n)
+            out.extend(lit[:n])
+            del lit[:n]
+
+    i = 0
+    while i < len(pixels):
+        j = i
+        while (j < len(pixels)) and (pixels[j] == pixels[i]) and (j - i < 0x7FFF):
+            j = j + 1
+        if j - i >= 3:                  # a run packet costs 2 halfwords
+            flush_literal()
+            out.extend([j - i, pixels[i]])
+        else:
+            lit.extend(pixels[i:j])
+        i = j
+    flush_literal()
+    return out
+
+
+def rgb(c):
+    return ((c >> 11) & 0x1F) << 3, ((c >> 5) & 0x3F) << 2, (c & 0x1F) << 3
+
+
+def nearest(c, palette):
+    r, g, b = rgb(c)
+    best = 0
+    bestd = None
+    for k, p in enumerate(palette):
+        pr, pg, pb = rgb(p)
+        d = (r - pr)**2 + (g - pg)**2 + (b - pb)**2
+        if (bestd is None) or (d < bestd):
+            best, bestd = k, d
+    return best
+
+
+def palette(pixels, size):
+    count = {}
+    for c in pixels:
+        count[c] = count.get(c, 0) + 1
+    pal = sorted(count, key=lambda c: -count[c])[:size]
+    lookup = {c: (pal.index(c) if c in pal else nearest(c, pal)) for c in count}
+    return pal, [lookup[c] for c in pixels]
+
+
+def pack4(indices, w, h):
+    out = []
+    for y in range(h):
+        row = indices[y*w:(y+1)*w] + [0]*(w & 1)
+        for x in range(0, len(row), 2):
+            out.append((row[x] << 4) | row[x+1])
+    return out
+
+
+def c_array(ctype, name, values, fmt):
+    lines = []
+    for i in range(0, len(values), 16):
+        lines.append('  ' + ', '.join(fmt % v for v in values[i:i+16]) + ',')
+    return 'static const %s %s[%d] = {\n%s\n};\n' % (ctype, name, len(values), '\n'.join(lines))
+
+
+def convert(path, force_pal4):
+    name, w, h, pixels = read_image(path)
+    colors = len(set(pixels))
+    out = ['// %s_ili.h' % name,
+           '// Made by Bitmaps/lvimg2ili.py from %s; do not edit.' % os.path.basename(path),
+           '// %dx%d pixels, %d colors, top row first, standard RGB565' % (w, h, colors),
+           '#include <stdint.h>',
+           '']
+    out.append('#define %s_W %d' % (name.upper(), w))
+    out.append('#define %s_H %d' % (name.upper(), h))
+    out.append('')
+    packets = rle(pixels)
+    best = (2*len(packets), 'rle',
+            ['// ILI9341_DrawBitmapRLE(x, y, %s_rle, %d, %d);' % (name, w, h),
+             c_array('uint16_t', name + '_rle', packets, '0x%04X')])
+    sizes = ['raw %d' % (2*w*h), 'rle %d' % best[0]]
+    if (colors <= 16) or force_pal4:
+        pal, indices = palette(pixels, 16)
+        data = pack4(indices, w, h)
+        size = 2*len(pal) + len(data)
+        sizes.append('pal4 %d' % size)
+        lines = []
+        if colors > 16:
+            lines.append('// %d colors reduced to 16' % colors)
+        lines.append('// ILI9341_DrawBitmapPal4(x, y, %s_pal, %s_pal4, %d, %d);' % (name, name, w, h))
+        lines.append(c_array('uint16_t', name + '_pal', pal, '0x%04X'))
+        lines.append(c_array('uint8_t', name + '_pal4', data, '0x%02X'))
+        if (size < best[0]) or force_pal4:
+            best = (size, 'pal4', lines)
+    elif colors <= 256:
+        pal, indices = palette(pixels, 256)
+        size = 2*len(pal) + len(indices)
+        sizes.append('pal8 %d' % size)
+        lines = ['// ILI9341_DrawBitmapPal8(x, y, %s_pal, %s_pal8, %d, %d);' % (name, name, w, h),
+                 c_array('uint16_t', name + '_pal', pal, '0x%04X'),
+                 c_array('uint8_t', name + '_pal8', indices, '0x%02X')]
+        if size < best[0]:
+            best = (size, 'pal8', lines)
+    out.extend(best[2])
+    dest = os.path.join(os.path.dirname(path), name + '_ili.h')
+    open(dest, 'w').write('\n'.join(out) + '\n')
+    print('%s: %s bytes, wrote %s' % (dest, ', '.join(sizes), best[1]))
+
+
+# lv_color32_t is blue, green, red, alpha in memory
+def convert_lvgl(path):
+    name, w, h, pixels = read_image(path)
+    colors = len(set(pixels))
+    pal, indices = palette(pixels, 256)
+    data = []
+    for c in pal + [0]*(256 - len(pal)):
+        r, g, b = rgb(c)
+        data.extend([b, g, r, 0xFF])
+    data.extend(indices)
+    out = ['// %s_i8.h' % name,
+           '// Made by Bitmaps/lvimg2ili.py --lvgl from %s; do not edit.' % os.path.basename(path),
+           '// %dx%d pixels, %d colors, LV_IMG_CF_INDEXED_8BIT' % (w, h, colors),
+           '#include "../lvgl/lvgl.h"',
+           '']
+    if colors > 256:
+        out.append('// %d colors reduced to 256' % colors)
+    out.append(c_array('uint8_t', name + '_i8_map', data, '0x%02X'))
+    out.append('static const lv_img_dsc_t %s_i8 = {' % name)
+    out.append('  .header.always_zero = 0,')
+    out.append('  .header.w = %d,' % w)
+    out.append('  .header.h = %d,' % h)
+    out.append('  .data_size = %d,' % len(data))
+    out.append('  .header.cf = LV_IMG_CF_INDEXED_8BIT,')
+    out.append('  .data = %s_i8_map,' % name)
+    out.append('};')
+    dest = os.path.join(os.path.dirname(path), name + '_i8.h')
+    open(dest, 'w').write('\n'.join(out) + '\n')
+    print('%s: raw %d, indexed %d bytes' % (dest, 2*w*h, len(data)))
+
+
+if __name__ == '__main__':
+    args = sys.argv[1:]
+    force = '--pal4' in args
+    lvgl = '--lvgl' in args
+    args = [a for a in args if a not in ('--pal4', '--lvgl')]
+    if not args:
+        sys.exit('usage: python3 lvimg2ili.py [--pal4 | --lvgl] Name.h [more.h ...]')
+    for a in args:
+        if lvgl:
+            convert_lvgl(a)
+        else:
+            convert(a, force)
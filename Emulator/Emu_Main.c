@@ -0,0 +1,214 @@
+// Emu_Main.c
+// Runs on a PC (Linux, macOS or Cygwin)
+// Draws a fixed set of scenes with Periphs/src/ILI9341.c on the
+// emulated panel.  For each scene it prints the SSI0 traffic and
+// a hash of the screen, and saves the screen as <dir>/<scene>.ppm.
+// The printout of a known good build is the reference, kept in
+// scenes.ref: after a change to the driver, a different hash means
+// the picture changed (make test fails) and a different byte
+// count means the traffic changed.
+// The batch scenes are drawn twice, once directly and once
+// through ILI9341_BatchBegin(); built with ILI9341_TILES 1 the
+// second goes through the tile compositor, and the program exits
+// with 1 if the two pictures differ.
+// usage: ili9341_emu [output directory, default out]
+
+#include <stdio.h>
+#include <stdint.h>
+#include "ILI9341_Emu.h"
+#include "../Periphs/inc/ILI9341.h"
+#include "../Bitmaps/Longhorn_ili.h"
+#include "../Bitmaps/Call_icon_ili.h"
+#include "../Bitmaps/Text_icon_ili.h"
+
+static const char *OutDir = "out";
+static Emu_Counts_t Start;
+static int Failed;              // nonzero if a batch scene differs
+
+// Start counting the traffic of one scene
+void static sceneBegin(void){
+  Emu_GetCounts(&Start);
+}
+
+// Print the traffic and hash of the scene and save its picture
+void static sceneEnd(const char *name){
+  Emu_Counts_t now;
+  char path[256];
+  Emu_GetCounts(&now);
+  printf("%-10s %7u cmd %8u data %5u win %7u px %8.1f us  %08X\n", name,
+    (unsigned)(now.commands - Start.commands),
+    (unsigned)(now.dataBytes - Start.dataBytes),
+    (unsigned)(now.windows - Start.windows),
+    (unsigned)(now.pixels - Start.pixels),
+    (double)(now.cycles - Start.cycles)*1e6/EMU_BUSCLK,
+    (unsigned)Emu_Checksum());
+  snprintf(path, sizeof(path), "%s/%s.ppm", OutDir, name);
+  if(Emu_WritePPM(path) == 0){
+    fprintf(stderr, "could not write %s\n", path);
+  }
+}
+
+// Triangle wave from -100 to 100 with a period of 64 samples
+int32_t static wave(int32_t i){
+  i = i%64;
+  return (i < 32) ? (-100 + 200*i/32) : (100 - 200*(i-32)/32);
+}
+
+// Fill screen rows y0 to y1 through the scrolling row mapping,
+// one window per run of consecutive panel rows, as my_disp_flush()
+// in UI/UI_Components.c does
+void static scrollFill(int32_t y0, int32_t y1, uint16_t color){
+  int32_t y, rows;
+  for(y=y0; y<=y1; y=y+rows){
+    rows = ILI9341_ScrollRows(y);
+    if(rows > y1-y+1) rows = y1-y+1;
+    ILI9341_FillRect(0, ILI9341_ScrollRow(y), 240, rows, color);
+  }
+}
+
+#define BATCH_X 0               // region of the batch scenes
+#define BATCH_Y 0
+#define BATCH_W 240
+#define BATCH_H 120
+#define BATCH_BG ILI9341_Color565(0, 0, 96)
+
+// Primitives of the batch scenes: overlapping rectangles, a line
+// and characters across them; full adds enough rectangles that
+// the list of ILI9341_BATCH_OPS primitives fills up two
+// characters into "ABCD", so C and D are drawn directly
+void static batchDraw(int full){
+  int32_t i;
+  ILI9341_FillRect(10, 20, 120, 50, ILI9341_RED);
+  ILI9341_FillRect(60, 40, 120, 50, ILI9341_GREEN);
+  ILI9341_Line(0, 99, 239, 10, ILI9341_WHITE);
+  ILI9341_DrawCharS(100, 30, 'X', ILI9341_YELLOW, ILI9341_YELLOW, 3);
+  ILI9341_DrawString(1, 8, "Over", ILI9341_CYAN);
+  if(full){
+    for(i=0; i<ILI9341_BATCH_OPS-10; i=i+1){
+      ILI9341_FillRect(i*10, 104, 8, 8, ILI9341_Color565(i*11, 255-i*11, 128));
+    }
+    ILI9341_DrawString(0, 0, "ABCD", ILI9341_WHITE);
+    ILI9341_FillRect(200, 10, 30, 30, ILI9341_MAGENTA);
+  }
+}
+
+// Draw a batch scene directly, then through the batch, and
+// compare the two pictures
+void static batchScene(const char *name, int full){
+  uint32_t direct;
+  ILI9341_FillScreen(ILI9341_BLACK);
+  ILI9341_FillRect(BATCH_X, BATCH_Y, BATCH_W, BATCH_H, BATCH_BG);
+  batchDraw(full);
+  direct = Emu_Checksum();
+  ILI9341_FillScreen(ILI9341_BLACK);
+  sceneBegin();
+  ILI9341_BatchBegin(BATCH_X, BATCH_Y, BATCH_W, BATCH_H, BATCH_BG);
+  batchDraw(full);
+  ILI9341_BatchEnd();
+  sceneEnd(name);
+  if(Emu_Checksum() != direct){
+    fprintf(stderr, "%s differs from direct drawing\n", name);
+    Failed = 1;
+  }
+}
+
+int main(int argc, char **argv){
+  int32_t i;
+  if(argc > 1){
+    OutDir = argv[1];
+  }
+  Emu_Reset();
+
+  sceneBegin();
+  ILI9341_InitR(INITR_BLACKTAB);
+  sceneEnd("init");
+
+  sceneBegin();
+  ILI9341_FillRect(10, 10, 100, 60, ILI9341_RED);
+  ILI9341_FillRect(60, 40, 100, 60, ILI9341_GREEN);
+  ILI9341_FillRect(110, 70, 100, 60, ILI9341_BLUE);
+  ILI9341_DrawFastHLine(0, 150, 240, ILI9341_WHITE);
+  ILI9341_DrawFastVLine(120, 0, 320, ILI9341_WHITE);
+  sceneEnd("rects");
+
+  sceneBegin();
+  for(i=0; i<240; i=i+24){
+    ILI9341_Line(0, 319, i, 160, ILI9341_YELLOW);
+  }
+  ILI9341_Line(239, 160, 0, 319, ILI9341_CYAN);
+  sceneEnd("lines");
+
+  ILI9341_FillScreen(ILI9341_BLACK);
+  sceneBegin();
+  ILI9341_DrawString(0, 0, "Hello, world", ILI9341_WHITE);
+  ILI9341_DrawString(2, 1, "0123456789 !?#", ILI9341_YELLOW);
+  ILI9341_DrawCharS(10, 40, 'A', ILI9341_RED, ILI9341_BLACK, 4);
+  ILI9341_DrawChar(50, 40, 'B', ILI9341_GREEN, ILI9341_BLUE, 4);
+  ILI9341_DrawCharS(90, 40, 'C', ILI9341_CYAN, ILI9341_CYAN, 4);
+  sceneEnd("text");
+
+  ILI9341_FillScreen(ILI9341_BLACK);
+  sceneBegin();
+  ILI9341_DrawBitmapRLE(55, 10, Longhorn_rle, LONGHORN_W, LONGHORN_H);
+  ILI9341_DrawBitmapRLE(20, 150, Longhorn_rle, LONGHORN_W, LONGHORN_H);
+  sceneEnd("rle");
+
+  ILI9341_FillScreen(ILI9341_BLACK);
+  sceneBegin();
+  ILI9341_DrawBitmapPal8(20, 150, Call_icon_pal, Call_icon_pal8, CALL_ICON_W, CALL_ICON_H);
+  ILI9341_DrawBitmapPal8(130, 150, Text_icon_pal, Text_icon_pal8, TEXT_ICON_W, TEXT_ICON_H);
+  sceneEnd("pal8");
+
+  sceneBegin();
+  ILI9341_PlotClear(-110, 110);
+  for(i=0; i<128; i=i+1){
+    ILI9341_PlotLine(wave(i));
+    ILI9341_PlotNext();
+  }
+  sceneEnd("plot");
+
+  ILI9341_SetPixelMode(ILI9341_PIXELS_16BIT);
+  sceneBegin();
+  ILI9341_FillScreen(ILI9341_MAGENTA);
+  ILI9341_DrawBitmapRLE(55, 95, Longhorn_rle, LONGHORN_W, LONGHORN_H);
+  sceneEnd("pixels16");
+  ILI9341_SetPixelMode(ILI9341_PIXELS_8BIT);
+
+  sceneBegin();
+  ILI9341_SetPartialArea(20, 79);
+  ILI9341_IdleMode(1);
+  sceneEnd("idle");
+
+  sceneBegin();
+  ILI9341_IdleMode(0);
+  ILI9341_NormalMode();
+  sceneEnd("wake");
+
+  sceneBegin();
+  ILI9341_SetRotation(1);
+  ILI9341_FillScreen(ILI9341_BLACK);
+  ILI9341_DrawString(0, 0, "Rotation 1", ILI9341_WHITE);
+  ILI9341_FillRect(280, 200, 40, 40, ILI9341_RED);
+  ILI9341_SetRotation(0);
+  sceneEnd("rotate");
+
+  ILI9341_FillScreen(ILI9341_BLACK);
+  sceneBegin();
+  if(ILI9341_SetScrollRegion(40, 279) == 0){
+    fprintf(stderr, "scroll region refused\n");
+    Failed = 1;
+  }
+  for(i=0; i<12; i=i+1){                // stripes 20 rows high
+    scrollFill(40+20*i, 59+20*i, ILI9341_Color565(20*i, 255-20*i, (i&1)*255));
+  }
+  ILI9341_Scroll(30);                   // rows 250 to 279 wrap to the top of the area
+  scrollFill(200, 279, ILI9341_WHITE);  // crosses the wrap: two windows
+  ILI9341_Scroll(-70);
+  scrollFill(40, 79, ILI9341_RED);      // crosses it the other way
+  sceneEnd("scroll");
+  ILI9341_SetScrollRegion(0, 319);
+
+  batchScene("batch", 0);
+  batchScene("batchfull", 1);
+  return Failed;
+}
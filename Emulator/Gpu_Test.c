@@ -0,0 +1,98 @@
+// Gpu_Test.c
+// Runs on a PC (Linux, macOS or Cygwin)
+// Checks the RGB565 kernels of UI/UI_Gpu.c against the pixel
+// loops LittlevGL runs when there is no GPU: UI_GpuBlend() must
+// give lv_color_mix(src, dest, opa) for every pixel, and
+// UI_GpuFill() must set every pixel, for every length from 0 to
+// MAXLEN, both halfword alignments of dest and of src and every
+// opacity.  The pixels around the ones written must not change.
+// usage: gpu_test
+// Prints the number of cases and exits with 1 if any failed.
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include "../UI/UI_Gpu.h"
+
+#define MAXLEN 40               // longest run tested, in pixels
+#define GUARD  4                // pixels checked on each side of a run
+#define BUFLEN (MAXLEN+2*GUARD+2)
+
+// RGB565 with LV_COLOR_16_SWAP 0, as lv_color16_t in lv_color.h
+typedef union{
+  struct{
+    uint16_t blue : 5;
+    uint16_t green : 6;
+    uint16_t red : 5;
+  } ch;
+  uint16_t full;
+} color16_t;
+
+// lv_color_mix() of LittlevGL v6 for LV_COLOR_DEPTH 16
+uint16_t static colorMix(uint16_t c1, uint16_t c2, uint8_t mix){
+  color16_t a, b, ret;
+  a.full = c1;
+  b.full = c2;
+  ret.ch.red = (uint16_t)((uint16_t)a.ch.red*mix + b.ch.red*(255-mix)) >> 8;
+  ret.ch.green = (uint16_t)((uint16_t)a.ch.green*mix + b.ch.green*(255-mix)) >> 8;
+  ret.ch.blue = (uint16_t)((uint16_t)a.ch.blue*mix + b.ch.blue*(255-mix)) >> 8;
+  return ret.full;
+}
+
+// Same numbers on every host
+static uint32_t Seed = 1;
+uint16_t static random16(void){
+  Seed = Seed*1664525u + 1013904223u;
+  return (uint16_t)(Seed>>16);
+}
+
+// Word-aligned buffers, so index 1 is a halfword off
+static uint32_t SrcWords[BUFLEN/2+1], DestWords[BUFLEN/2+1];
+static uint16_t Expect[BUFLEN];
+
+int main(void){
+  uint16_t *src = (uint16_t *)SrcWords;
+  uint16_t *dest = (uint16_t *)DestWords;
+  uint32_t n, i;
+  int32_t so, dof, opa;
+  uint32_t cases = 0, failed = 0;
+  uint16_t color;
+  for(n=0; n<=MAXLEN; n=n+1){
+    for(so=0; so<2; so=so+1){
+      for(dof=0; dof<2; dof=dof+1){
+        for(opa=0; opa<256; opa=opa+1){
+          for(i=0; i<BUFLEN; i=i+1){
+            src[i] = random16();
+            dest[i] = Expect[i] = random16();
+          }
+          for(i=0; i<n; i=i+1){
+            Expect[GUARD+dof+i] = colorMix(src[GUARD+so+i], dest[GUARD+dof+i], opa);
+          }
+          UI_GpuBlend(&dest[GUARD+dof], &src[GUARD+so], n, opa);
+          cases = cases+1;
+          if(memcmp(dest, Expect, sizeof(Expect))){
+            failed = failed+1;
+            printf("blend n=%u src+%d dest+%d opa=%d differs\n", (unsigned)n, (int)so, (int)dof, (int)opa);
+          }
+        }
+      }
+    }
+    for(dof=0; dof<2; dof=dof+1){
+      color = random16();
+      for(i=0; i<BUFLEN; i=i+1){
+        dest[i] = Expect[i] = random16();
+      }
+      for(i=0; i<n; i=i+1){
+        Expect[GUARD+dof+i] = color;
+      }
+      UI_GpuFill(&dest[GUARD+dof], n, color);
+      cases = cases+1;
+      if(memcmp(dest, Expect, sizeof(Expect))){
+        failed = failed+1;
+        printf("fill n=%u dest+%d differs\n", (unsigned)n, (int)dof);
+      }
+    }
+  }
+  printf("gpu: %u cases, %u failed\n", (unsigned)cases, (unsigned)failed);
+  return failed ? 1 : 0;
+}
@@ -0,0 +1,363 @@
+// ILI9341_Emu.c
+// Runs on a PC (Linux, macOS or Cygwin)
+// Model of the ILI9341 panel on SSI0, for running
+// Periphs/src/ILI9341.c on the host.  See ILI9341_Emu.h.
+
+#include <stdio.h>
+#include <stdint.h>
+#include "ILI9341_Emu.h"
+#include "inc/tm4c123gh6pm.h"
+
+// panel commands the model understands
+#define CMD_SWRESET   0x01
+#define CMD_SLPIN     0x10
+#define CMD_SLPOUT    0x11
+#define CMD_PTLON     0x12
+#define CMD_NORON     0x13
+#define CMD_INVOFF    0x20
+#define CMD_INVON     0x21
+#define CMD_DISPOFF   0x28
+#define CMD_DISPON    0x29
+#define CMD_CASET     0x2A
+#define CMD_RASET     0x2B
+#define CMD_RAMWR     0x2C
+#define CMD_PTLAR     0x30
+#define CMD_VSCRDEF   0x33
+#define CMD_MADCTL    0x36
+#define CMD_VSCRSADD  0x37
+#define CMD_IDMOFF    0x38
+#define CMD_IDMON     0x39
+#define CMD_RAMWRC    0x3C
+
+#define MADCTL_MY  0x80
+#define MADCTL_MX  0x40
+#define MADCTL_MV  0x20
+#define MADCTL_BGR 0x08
+
+#define ADDR_DC       0x40004100
+#define ADDR_SSI0_CR0 0x40008000
+#define ADDR_SSI0_DR  0x40008008
+#define ADDR_SSI0_SR  0x4000800C
+#define ADDR_SSI0_CPSR 0x40008010
+#define ADDR_CYCCNT   0xE0001004
+
+// registers, found by address
+#define NUMREGS 64
+static uint32_t RegAddress[NUMREGS];
+static volatile uint32_t RegValue[NUMREGS];
+static int NumRegs;
+
+// SSI0 data register: the driver writes a frame into DrSlot,
+// which is decoded on the next register access
+static volatile uint32_t DrSlot;
+static int DrPending;                   // DrSlot holds a frame not decoded yet
+static uint32_t DrDc;                   // DC pin while that frame was sent
+static uint32_t DrBits;                 // its size, 8 or 16 bits
+static volatile uint32_t Sr;            // what SSI0_SR_R reads
+static volatile uint32_t CycCnt;        // what DWT_CYCCNT_R reads
+
+// panel state
+static uint16_t Gram[EMU_HEIGHT][EMU_WIDTH]; // panel memory, as sent
+static Emu_Counts_t Counts;
+static uint8_t Cmd;                     // last command
+static uint8_t Params[8];               // its parameter bytes
+static int NumParams;
+static int HaveHigh;                    // RAMWR in 8-bit frames: High holds the first byte
+static uint8_t High;
+static uint16_t Xs, Xe, Ys, Ye;         // address window, in MADCTL order
+static uint16_t Col, Page;              // next pixel in the window
+static uint8_t Madctl;
+static int Inverted, DisplayOn, Scrolling, Partial, Idle, Sleeping;
+static uint16_t Tfa, Vsa, Vsp;          // scrolling area and start
+static uint16_t Psr, Per;               // partial area rows
+
+
+//------------Emu_Reset------------
+// Put the panel model in its power-on state: memory black,
+// counts zero, default MADCTL.
+// Input: none
+// Output: none
+void Emu_Reset(void){
+  int32_t x, y;
+  for(y=0; y<EMU_HEIGHT; y=y+1){
+    for(x=0; x<EMU_WIDTH; x=x+1){
+      Gram[y][x] = 0;
+    }
+  }
+  Counts = (Emu_Counts_t){0};
+  DrPending = 0;
+  Cmd = 0; NumParams = 0; HaveHigh = 0;
+  Xs = 0; Xe = EMU_WIDTH-1; Ys = 0; Ye = EMU_HEIGHT-1;
+  Col = 0; Page = 0;
+  Madctl = 0;
+  Inverted = 0; DisplayOn = 0; Scrolling = 0;
+  Partial = 0; Idle = 0; Sleeping = 1;
+  Tfa = 0; Vsa = EMU_HEIGHT; Vsp = 0;
+  Psr = 0; Per = EMU_HEIGHT-1;
+}
+
+
+// Store one color at the window position and step to the next;
+// like the panel, the position wraps to the top of the window
+void static emuPixel(uint16_t color){
+  uint32_t a, b, cols, pages;
+  if(Madctl&MADCTL_MV){
+    cols = EMU_HEIGHT; pages = EMU_WIDTH;
+    a = Page; b = Col;                  // columns run down the memory
+  } else{
+    cols = EMU_WIDTH; pages = EMU_HEIGHT;
+    a = Col; b = Page;
+  }
+  if((Col < cols) && (Page < pages)){
+    a = (Madctl&MADCTL_MX) ? EMU_WIDTH-1-a : a;
+    b = (Madctl&MADCTL_MY) ? EMU_HEIGHT-1-b : b;
+    Gram[b][a] = color;
+  }
+  Counts.pixels++;
+  Col++;
+  if(Col > Xe){
+    Col = Xs;
+    Page++;
+    if(Page > Ye){
+      Page = Ys;
+    }
+  }
+}
+
+
+// Start a command
+void static emuCommand(uint8_t c){
+  Cmd = c;
+  NumParams = 0;
+  HaveHigh = 0;
+  switch(c){
+    case CMD_SWRESET:
+      Madctl = 0; Inverted = 0; DisplayOn = 0; Scrolling = 0;
+      Partial = 0; Idle = 0; Sleeping = 1;
+      break;
+    case CMD_SLPIN:   Sleeping = 1; break;
+    case CMD_SLPOUT:  Sleeping = 0; break;
+    case CMD_PTLON:   Partial = 1; break;
+    case CMD_NORON:   Scrolling = 0; Partial = 0; break;
+    case CMD_IDMOFF:  Idle = 0; break;
+    case CMD_IDMON:   Idle = 1; break;
+    case CMD_INVOFF:  Inverted = 0; break;
+    case CMD_INVON:   Inverted = 1; break;
+    case CMD_DISPOFF: DisplayOn = 0; break;
+    case CMD_DISPON:  DisplayOn = 1; break;
+    case CMD_RAMWR:
+      Counts.windows++;
+      Col = Xs;
+      Page = Ys;
+      break;
+  }
+}
+
+
+// Take one data byte of the current command
+void static emuData(uint8_t d){
+  if((Cmd == CMD_RAMWR) || (Cmd == CMD_RAMWRC)){
+    if(HaveHigh){
+      emuPixel((High<<8)|d);
+      HaveHigh = 0;
+    } else{
+      High = d;
+      HaveHigh = 1;
+    }
+    return;
+  }
+  if(NumParams < (int)sizeof(Params)){
+    Params[NumParams] = d;
+  }
+  NumParams++;
+  if((Cmd == CMD_CASET) && (NumParams == 4)){
+    Xs = (Params[0]<<8)|Params[1];
+    Xe = (Params[2]<<8)|Params[3];
+  } else if((Cmd == CMD_RASET) && (NumParams == 4)){
+    Ys = (Params[0]<<8)|Params[1];
+    Ye = (Params[2]<<8)|Params[3];
+  } else if((Cmd == CMD_MADCTL) && (NumParams == 1)){
+    Madctl = d;
+  } else if((Cmd == CMD_PTLAR) && (NumParams == 4)){
+    Psr = (Params[0]<<8)|Params[1];
+    Per = (Params[2]<<8)|Params[3];
+  } else if((Cmd == CMD_VSCRDEF) && (NumParams == 6)){
+    Tfa = (Params[0]<<8)|Params[1];
+    Vsa = (Params[2]<<8)|Params[3];
+  } else if((Cmd == CMD_VSCRSADD) && (NumParams == 2)){
+    Vsp = (Params[0]<<8)|Params[1];
+    Scrolling = 1;
+  }
+}
+
+
+// Decode the frame waiting in DrSlot, if any
+void static emuShift(void){
+  uint32_t cpsr, scr;
+  if(DrPending == 0) return;
+  DrPending = 0;
+  cpsr = EMU_REG(ADDR_SSI0_CPSR)&0xFF;
+  scr = (EMU_REG(ADDR_SSI0_CR0)>>8)&0xFF;
+  Counts.cycles += DrBits*(cpsr ? cpsr : 2)*(1+scr);
+  CycCnt = CycCnt + DrBits*(cpsr ? cpsr : 2)*(1+scr);
+  if(DrDc == 0){
+    Counts.commands++;
+    emuCommand(DrSlot&0xFF);
+  } else if(DrBits == 16){
+    Counts.dataBytes += 2;
+    if((Cmd == CMD_RAMWR) || (Cmd == CMD_RAMWRC)){
+      emuPixel(DrSlot&0xFFFF);
+    } else{
+      emuData((DrSlot>>8)&0xFF);
+      emuData(DrSlot&0xFF);
+    }
+  } else{
+    Counts.dataBytes++;
+    emuData(DrSlot&0xFF);
+  }
+}
+
+
+//------------Emu_Reg------------
+// Find the word behind a register address.
+// Input: address register address on the TM4C123
+// Output: pointer to the emulated register
+volatile uint32_t *Emu_Reg(uint32_t address){
+  int i;
+  if(address == ADDR_SSI0_DR){          // a new frame, sent with DC as it is now
+    emuShift();
+    DrPending = 1;
+    DrDc = EMU_REG(ADDR_DC);
+    DrBits = (EMU_REG(ADDR_SSI0_CR0)&0x0F) + 1;
+    return &DrSlot;
+  }
+  if(address == ADDR_SSI0_SR){          // TFE and TNF, never busy
+    emuShift();
+    Sr = 0x03;
+    return &Sr;
+  }
+  if(address == ADDR_CYCCNT){
+    emuShift();
+    return &CycCnt;
+  }
+  for(i=0; i<NumRegs; i=i+1){
+    if(RegAddress[i] == address) break;
+  }
+  if(i == NumRegs){
+    if(NumRegs == NUMREGS){
+      fprintf(stderr, "Emu_Reg: too many registers (0x%08X)\n", (unsigned)address);
+      i = NUMREGS-1;
+    } else{
+      NumRegs++;
+      RegAddress[i] = address;
+      RegValue[i] = 0;
+    }
+  }
+  if((address&0xFFFFFF00) == 0x400FEA00){
+    RegValue[i] = 0xFFFFFFFF;           // peripheral ready registers
+  }
+  return &RegValue[i];
+}
+
+
+//------------Emu_GetCounts------------
+// Copy the traffic counts since Emu_Reset().
+// Input: counts where to put them
+// Output: none
+void Emu_GetCounts(Emu_Counts_t *counts){
+  emuShift();
+  *counts = Counts;
+}
+
+
+//------------Emu_GetPixel------------
+// Read one pixel of the image, with scrolling, inversion,
+// partial and idle modes, sleep and display off applied as the
+// glass would show them (black where it is not lit).
+// Input: x columns from the left edge (0 to 239)
+//        y rows from the top edge (0 to 319)
+// Output: 24-bit color 0xRRGGBB
+uint32_t Emu_GetPixel(int32_t x, int32_t y){
+  uint32_t c, r, g, b;
+  emuShift();
+  if((DisplayOn == 0) || Sleeping || (x < 0) || (x >= EMU_WIDTH) || (y < 0) || (y >= EMU_HEIGHT)){
+    return 0;
+  }
+  if(Partial && ((Psr <= Per) ? ((y < Psr) || (y > Per)) : ((y < Psr) && (y > Per)))){
+    return 0;                           // outside the partial area, which may wrap
+  }
+  if(Scrolling && (Vsa > 0) && (y >= Tfa) && (y < Tfa+Vsa)){
+    y = Tfa + ((y - Tfa) + (Vsp - Tfa) + Vsa)%Vsa;
+    if(y >= EMU_HEIGHT) return 0;
+  }
+  c = Gram[y][EMU_WIDTH-1-x];           // the panel's columns run right to left
+  if(Inverted){
+    c = (~c)&0xFFFF;
+  }
+  r = (c>>11)&0x1F;
+  g = (c>>5)&0x3F;
+  b = c&0x1F;
+  if((Madctl&MADCTL_BGR) == 0){         // the color filter is BGR
+    uint32_t t = r; r = b; b = t;
+  }
+  if(Idle){                             // 8 colors, by the top bits
+    r = (r&0x10) ? 0x1F : 0;
+    g = (g&0x20) ? 0x3F : 0;
+    b = (b&0x10) ? 0x1F : 0;
+  }
+  r = (r<<3)|(r>>2);
+  g = (g<<2)|(g>>4);
+  b = (b<<3)|(b>>2);
+  return (r<<16)|(g<<8)|b;
+}
+
+
+//------------Emu_Checksum------------
+// Hash the image, so two runs can be compared without saving it.
+// Input: none
+// Output: 32-bit FNV-1a hash of the 0xRRGGBB pixels, top row first
+uint32_t Emu_Checksum(void){
+  uint32_t hash = 2166136261u, c;
+  int32_t x, y, i;
+  for(y=0; y<EMU_HEIGHT; y=y+1){
+    for(x=0; x<EMU_WIDTH; x=x+1){
+      c = Emu_GetPixel(x, y);
+      for(i=16; i>=0; i=i-8){
+        hash = (hash ^ ((c>>i)&0xFF))*16777619u;
+      }
+    }
+  }
+  return hash;
+}
+
+
+//------------Emu_WritePPM------------
+// Save the image as a binary (P6) PPM file.
+// Input: path file name
+// Output: 1 if successful, 0 if the file could not be written
+int Emu_WritePPM(const char *path){
+  FILE *f;
+  uint32_t c;
+  int32_t x, y;
+  f = fopen(path, "wb");
+  if(f == 0) return 0;
+  fprintf(f, "P6\n%d %d\n255\n", EMU_WIDTH, EMU_HEIGHT);
+  for(y=0; y<EMU_HEIGHT; y=y+1){
+    for(x=0; x<EMU_WIDTH; x=x+1){
+      c = Emu_GetPixel(x, y);
+      fputc((c>>16)&0xFF, f);
+      fputc((c>>8)&0xFF, f);
+      fputc(c&0xFF, f);
+    }
+  }
+  return fclose(f) == 0;
+}
+
+
+// startup.s on the board
+long StartCritical(void){
+  return 0;
+}
+void EndCritical(long sr){
+  (void)sr;
+}
@@ -0,0 +1,64 @@
+// ILI9341_Emu.h
+// Runs on a PC (Linux, macOS or Cygwin)
+// Model of the ILI9341 panel on SSI0, for running
+// Periphs/src/ILI9341.c on the host.  The frames the driver
+// writes to SSI0_DR_R are decoded (CASET, RASET, RAMWR, RAMWRC,
+// MADCTL, VSCRDEF, VSCRSADD, INVON/INVOFF, DISPON/DISPOFF,
+// PTLAR/PTLON/NORON, IDMON/IDMOFF, SLPIN/SLPOUT) into the
+// panel's 240x320 memory, and the traffic is counted.
+// The image is what the phone shows in the driver's default
+// orientation (ILI9341_DEFAULT_ROTATION 0, ILI9341_MIRROR_Y),
+// 240 wide by 320 high.
+
+#ifndef _ILI9341EMUH_
+#define _ILI9341EMUH_
+#include <stdint.h>
+
+#define EMU_WIDTH   240
+#define EMU_HEIGHT  320
+#define EMU_BUSCLK  80000000  // TM4C123 clock the SSI0 divider applies to
+
+// SSI0 traffic the panel has received
+typedef struct{
+  uint32_t commands;            // bytes sent with DC low
+  uint32_t dataBytes;           // bytes sent with DC high
+  uint32_t windows;             // RAMWR commands, one per address window
+  uint32_t pixels;              // colors written into the panel memory
+  uint64_t cycles;              // bus cycles SSI0 took to shift it all out
+} Emu_Counts_t;
+
+//------------Emu_Reset------------
+// Put the panel model in its power-on state: memory black,
+// counts zero, default MADCTL.
+// Input: none
+// Output: none
+void Emu_Reset(void);
+
+//------------Emu_GetCounts------------
+// Copy the traffic counts since Emu_Reset().
+// Input: counts where to put them
+// Output: none
+void Emu_GetCounts(Emu_Counts_t *counts);
+
+//------------Emu_GetPixel------------
+// Read one pixel of the image, with scrolling, inversion,
+// partial and idle modes, sleep and display off applied as the
+// glass would show them (black where it is not lit).
+// Input: x columns from the left edge (0 to 239)
+//        y rows from the top edge (0 to 319)
+// Output: 24-bit color 0xRRGGBB
+uint32_t Emu_GetPixel(int32_t x, int32_t y);
+
+//------------Emu_Checksum------------
+// Hash the image, so two runs can be compared without saving it.
+// Input: none
+// Output: 32-bit FNV-1a hash of the 0xRRGGBB pixels, top row first
+uint32_t Emu_Checksum(void);
+
+//------------Emu_WritePPM------------
+// Save the image as a binary (P6) PPM file.
+// Input: path file name
+// Output: 1 if successful, 0 if the file could not be written
+int Emu_WritePPM(const char *path);
+
+#endif
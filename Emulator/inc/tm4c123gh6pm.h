@@ -0,0 +1,85 @@
+// tm4c123gh6pm.h
+// Runs on a PC (Linux, macOS or Cygwin)
+// Host stand-in for the TM4C123 register header, used only by
+// the ILI9341 emulator in Emulator/.  It covers the registers
+// that Periphs/src/ILI9341.c touches.  Every register is a word
+// returned by Emu_Reg() at its real address, so reads and
+// writes compile exactly as on the board.  The SSI0 data
+// register goes to the panel model in ILI9341_Emu.c, the status
+// register always reads "transmit FIFO empty, not busy", and
+// the peripheral ready registers always read "ready".
+
+#ifndef __TM4C123GH6PM_H__
+#define __TM4C123GH6PM_H__
+#include <stdint.h>
+
+//------------Emu_Reg------------
+// Find the word behind a register address.
+// Input: address register address on the TM4C123
+// Output: pointer to the emulated register
+volatile uint32_t *Emu_Reg(uint32_t address);
+#define EMU_REG(a)              (*Emu_Reg(a))
+
+// Port A pins of the display, defined by ILI9341.c on the board
+#define TFT_CS                  EMU_REG(0x40004020)
+#define DC                      EMU_REG(0x40004100)
+#define RESET                   EMU_REG(0x40004200)
+
+#define GPIO_PORTA_DIR_R        EMU_REG(0x40004400)
+#define GPIO_PORTA_AFSEL_R      EMU_REG(0x40004420)
+#define GPIO_PORTA_DEN_R        EMU_REG(0x4000451C)
+#define GPIO_PORTA_AMSEL_R      EMU_REG(0x40004528)
+#define GPIO_PORTA_PCTL_R       EMU_REG(0x4000452C)
+
+#define SSI0_CR0_R              EMU_REG(0x40008000)
+#define SSI0_CR1_R              EMU_REG(0x40008004)
+#define SSI0_DR_R               EMU_REG(0x40008008)
+#define SSI0_SR_R               EMU_REG(0x4000800C)
+#define SSI0_CPSR_R             EMU_REG(0x40008010)
+#define SSI0_IM_R               EMU_REG(0x40008014)
+#define SSI0_MIS_R              EMU_REG(0x4000801C)
+#define SSI0_ICR_R              EMU_REG(0x40008020)
+#define SSI0_DMACTL_R           EMU_REG(0x40008024)
+#define SSI0_CC_R               EMU_REG(0x40008FC8)
+
+#define TIMER3_CFG_R            EMU_REG(0x40033000)
+#define TIMER3_TAMR_R           EMU_REG(0x40033004)
+#define TIMER3_CTL_R            EMU_REG(0x4003300C)
+#define TIMER3_IMR_R            EMU_REG(0x40033018)
+#define TIMER3_ICR_R            EMU_REG(0x40033024)
+#define TIMER3_TAILR_R          EMU_REG(0x40033028)
+#define TIMER3_TAPR_R           EMU_REG(0x40033038)
+
+#define SYSCTL_RCGCTIMER_R      EMU_REG(0x400FE604)
+#define SYSCTL_RCGCGPIO_R       EMU_REG(0x400FE608)
+#define SYSCTL_RCGCDMA_R        EMU_REG(0x400FE60C)
+#define SYSCTL_RCGCSSI_R        EMU_REG(0x400FE61C)
+#define SYSCTL_PRGPIO_R         EMU_REG(0x400FEA08)
+#define SYSCTL_PRDMA_R          EMU_REG(0x400FEA0C)
+
+#define UDMA_CFG_R              EMU_REG(0x400FF004)
+#define UDMA_CTLBASE_R          EMU_REG(0x400FF008)
+#define UDMA_USEBURSTCLR_R      EMU_REG(0x400FF01C)
+#define UDMA_REQMASKCLR_R       EMU_REG(0x400FF024)
+#define UDMA_ENASET_R           EMU_REG(0x400FF028)
+#define UDMA_ALTCLR_R           EMU_REG(0x400FF034)
+#define UDMA_PRIOCLR_R          EMU_REG(0x400FF03C)
+#define UDMA_CHIS_R             EMU_REG(0x400FF504)
+#define UDMA_CHMAP1_R           EMU_REG(0x400FF514)
+
+#define NVIC_EN0_R              EMU_REG(0xE000E100)
+#define NVIC_EN1_R              EMU_REG(0xE000E104)
+#define NVIC_PRI1_R             EMU_REG(0xE000E404)
+#define NVIC_PRI8_R             EMU_REG(0xE000E420)
+
+// Data Watchpoint and Trace unit, defined by ILI9341.c on the
+// board.  DWT_CYCCNT_R counts the 80 MHz cycles the emulated SSI0
+// has spent shifting frames out.
+#define DEMCR_R                 EMU_REG(0xE000EDFC)
+#define DWT_CTRL_R              EMU_REG(0xE0001000)
+#define DWT_CYCCNT_R            EMU_REG(0xE0001004)
+
+#define TIMER_ICR_TATOCINT      0x00000001  // GPTM Timer A Time-Out Raw
+                                            // Interrupt
+
+#endif
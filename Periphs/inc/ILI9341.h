@@ -102,15 +102,68 @@ enum initRFlags{
 #define ILI9341_TFTWIDTH  240
 #define ILI9341_TFTHEIGHT 320
 
+// 1 sends pixel blocks with uDMA channel 11 (SSI0 TX),
+// 0 sends them with the CPU
+#ifndef ILI9341_USE_UDMA
+#define ILI9341_USE_UDMA  1
+#endif
+
+// 1 counts the commands, data bytes, address windows and busy
+// waiting of the driver (ILI9341_GetStats()), 0 leaves it out
+#ifndef ILI9341_STATS
+#define ILI9341_STATS     1
+#endif
+
+// 1 adds the tile compositor (ILI9341_BatchBegin()), which costs
+// 2*ILI9341_TILE_PIXELS bytes of RAM for the tile and 20 bytes
+// per recorded primitive, 0 leaves it out
+#ifndef ILI9341_TILES
+#define ILI9341_TILES     0
+#endif
+#define ILI9341_TILE_PIXELS 1920  // 8 full-width rows
+#define ILI9341_BATCH_OPS   32    // primitives per batch
+
+// Mirroring flags for ILI9341_SetOrientation()
+#define ILI9341_MIRROR_X  0x01  // flip left-right
+#define ILI9341_MIRROR_Y  0x02  // flip top-bottom
+
+// Orientation set by ILI9341_InitR(INITR_BLACKTAB).  The phone's
+// panel is mounted upside down relative to rotation 0, so it is
+// mirrored top-bottom.  Rotations 1 and 3 make the screen 320 wide,
+// so LV_HOR_RES_MAX/LV_VER_RES_MAX in lv_conf.h must be swapped too.
+#ifndef ILI9341_DEFAULT_ROTATION
+#define ILI9341_DEFAULT_ROTATION  0
+#endif
+#ifndef ILI9341_DEFAULT_MIRROR
+#define ILI9341_DEFAULT_MIRROR    ILI9341_MIRROR_Y
+#endif
+
+// SSI frame size used for pixel data, see ILI9341_SetPixelMode()
+enum ILI9341_PixelMode{
+  ILI9341_PIXELS_8BIT,          // two 8-bit frames per pixel
+  ILI9341_PIXELS_16BIT          // one 16-bit frame per pixel
+};
+
+// SSI0 clock profiles for ILI9341_SetSpeed(), SSIClk = 80 MHz/CPSDVSR.
+// The ILI9341 write cycle is rated at 100 ns (10 MHz), but panels
+// usually take more; the TM4C123 SSI master tops out at 25 MHz.
+enum ILI9341_Speed{
+  ILI9341_SPEED_SAFE,           //  8 MHz, CPSDVSR 10, used by the init functions
+  ILI9341_SPEED_FAST,           // 13.3 MHz, CPSDVSR 6
+  ILI9341_SPEED_MAX             // 20 MHz, CPSDVSR 4, fastest even divider for an 80 MHz bus
+};
+
 
 // Color definitions
+// Standard RGB565 (red in the top 5 bits); the panel is set to
+// BGR order in MADCTL so this is also LittlevGL's lv_color_t
 #define ILI9341_BLACK   0x0000
-#define ILI9341_BLUE    0xF800
-#define ILI9341_RED     0x001F
+#define ILI9341_BLUE    0x001F
+#define ILI9341_RED     0xF800
 #define ILI9341_GREEN   0x07E0
-#define ILI9341_CYAN    0xFFE0
+#define ILI9341_CYAN    0x07FF
 #define ILI9341_MAGENTA 0xF81F
-#define ILI9341_YELLOW  0x07FF
+#define ILI9341_YELLOW  0xFFE0
 #define ILI9341_WHITE   0xFFFF
 
 //------------ILI9341_InitB------------
@@ -127,6 +180,199 @@ void ILI9341_InitB(void);
 void ILI9341_InitR(enum initRFlags option);
 
 
+//------------ILI9341_InitR_Start------------
+// Start the initialization of ILI9341R screens in the background.
+// The reset pulse and the command tables, with their delays of
+// up to 500 ms, are run from Timer3A one-shot interrupts, so the
+// caller can initialize other devices meanwhile.  No other
+// ILI9341 function may be called until ILI9341_InitR_Wait().
+// Input: option one of the enumerated options depending on tabs
+// Output: none
+// Uses Timer3A at priority 5.  Interrupts must be enabled before
+// ILI9341_InitR_Wait() for the sequence to finish.
+void ILI9341_InitR_Start(enum initRFlags option);
+
+
+//------------ILI9341_InitR_Done------------
+// Check whether the sequence started by ILI9341_InitR_Start()
+// has finished sending its command tables.
+// Input: none
+// Output: nonzero once ILI9341_InitR_Wait() will not wait
+int ILI9341_InitR_Done(void);
+
+
+//------------ILI9341_InitR_Wait------------
+// Wait for the sequence started by ILI9341_InitR_Start(), then
+// set the orientation and clear the screen as ILI9341_InitR()
+// does.  The screen is ready to draw on when it returns.
+// Input: none
+// Output: none
+void ILI9341_InitR_Wait(void);
+
+
+//------------ILI9341_SetWindow------------
+// Open an address window and leave the LCD in RAM write mode.
+// The following ILI9341_PushColor() calls fill the window left
+// to right, top to bottom, so a whole block costs one window.
+// Requires 11 bytes of transmission
+// Input: x0 horizontal position of the left edge, columns from the left edge
+//        y0 vertical position of the top edge, rows from the top edge
+//        x1 horizontal position of the right edge (inclusive)
+//        y1 vertical position of the bottom edge (inclusive)
+// Output: none
+// The window is not clipped; it must lie on the screen.
+void ILI9341_SetWindow(int16_t x0, int16_t y0, int16_t x1, int16_t y1);
+
+//------------ILI9341_PushColor------------
+// Send one pixel into the window opened by ILI9341_SetWindow().
+// Requires 2 bytes of transmission
+// Input: color 16-bit color, which can be produced by ILI9341_Color565()
+// Output: none
+void ILI9341_PushColor(uint16_t color);
+
+//------------ILI9341_SetPixelMode------------
+// Select how pixel data are sent after a RAMWR command.
+// ILI9341_PIXELS_8BIT sends each pixel as two 8-bit SSI frames.
+// ILI9341_PIXELS_16BIT switches SSI0 to 16-bit frames for the
+// pixels, one FIFO push per pixel, and back to 8-bit frames for
+// the next command.  The bytes on the wire are the same.
+// Input: mode ILI9341_PIXELS_8BIT or ILI9341_PIXELS_16BIT
+// Output: none
+void ILI9341_SetPixelMode(enum ILI9341_PixelMode mode);
+
+//------------ILI9341_SetSpeed------------
+// Change the SSI0 clock once everything queued has been sent.
+// Faster profiles may need short wires to the panel; check the
+// picture at each one before using it.
+// Input: speed ILI9341_SPEED_SAFE, ILI9341_SPEED_FAST or ILI9341_SPEED_MAX
+// Output: SSI clock in Hz
+uint32_t ILI9341_SetSpeed(enum ILI9341_Speed speed);
+
+//------------ILI9341_GetPixelMode------------
+// Report the pixel mode chosen by ILI9341_SetPixelMode().
+// Input: none
+// Output: ILI9341_PIXELS_8BIT or ILI9341_PIXELS_16BIT
+enum ILI9341_PixelMode ILI9341_GetPixelMode(void);
+
+//------------ILI9341_DMA_WritePixels------------
+// Send a block of pixels into the window opened by
+// ILI9341_SetWindow() without waiting for it.  In
+// ILI9341_PIXELS_16BIT mode each halfword is one native color.
+// In ILI9341_PIXELS_8BIT mode the data are sent as bytes in
+// memory order, so each halfword must hold the high byte of
+// the color first (byte-swapped 565).  The buffer must not
+// change until done() is called from the SSI0 interrupt.
+// Blocking drawing functions called in the meantime wait for
+// the block to be sent.
+// Requires 2*count bytes of transmission
+// Input: pixels pointer to the colors
+//        count  number of pixels
+//        done   function called when the buffer is free (may be 0)
+// Output: none
+// If ILI9341_USE_UDMA is 0 the pixels are sent with the CPU and
+// done() is called before returning.
+void ILI9341_DMA_WritePixels(const uint16_t *pixels, uint32_t count, void (*done)(void));
+
+//------------ILI9341_DMA_FillPixels------------
+// Send count copies of one color into the window opened by
+// ILI9341_SetWindow(), after any block already queued with
+// ILI9341_DMA_WritePixels(), without waiting for it.  The uDMA
+// reads the same halfword for every pixel, so no buffer is
+// needed.
+// Requires 2*count bytes of transmission
+// Input: color  16-bit color, which can be produced by ILI9341_Color565()
+//        count  number of pixels
+//        done   function called when the pixels have been queued (may be 0)
+// Output: none
+// In ILI9341_PIXELS_8BIT mode, or if ILI9341_USE_UDMA is 0, the
+// pixels are sent with the CPU and done() is called before
+// returning.
+void ILI9341_DMA_FillPixels(uint16_t color, uint32_t count, void (*done)(void));
+
+//------------ILI9341_SetAsync------------
+// Choose whether ILI9341_FillRect(), ILI9341_FillScreen() and
+// ILI9341_DrawBitmap() queue their work and return at once.
+// The queued operations are sent by the SSI0 interrupt, so the
+// bitmap data must stay valid until the queue is empty.  Every
+// other drawing function, and ILI9341_Async_Wait(), waits for
+// the queue to empty first, so the picture is the same as in
+// blocking mode.
+// Input: on 0 to block (default), nonzero to queue
+// Output: none
+// If ILI9341_USE_UDMA is 0 the drawing functions always block.
+void ILI9341_SetAsync(int on);
+
+//------------ILI9341_Async_Wait------------
+// Wait until every queued operation has been sent.
+// Input: none
+// Output: none
+void ILI9341_Async_Wait(void);
+
+//------------ILI9341_DMA_Busy------------
+// Check whether a ILI9341_DMA_WritePixels() block or any other
+// queued operation is still being sent.
+// Input: none
+// Output: nonzero while the block is in progress
+int ILI9341_DMA_Busy(void);
+
+// SSI traffic of the driver since ILI9341_ResetStats(), counted
+// when ILI9341_STATS is 1.  Queued operations are counted as the
+// SSI0 interrupt sends them.
+typedef struct{
+  uint32_t commands;            // command bytes
+  uint32_t dataBytes;           // parameter and pixel bytes
+  uint32_t windows;             // address windows opened
+  uint32_t waitCycles;          // bus cycles spent waiting for SSI0 or the queue
+} ILI9341_Stats_t;
+
+//------------ILI9341_GetStats------------
+// Copy the traffic counters.
+// Input: stats pointer to the structure to fill in
+// Output: none
+void ILI9341_GetStats(ILI9341_Stats_t *stats);
+
+//------------ILI9341_ResetStats------------
+// Set the traffic counters to zero.
+// Input: none
+// Output: none
+void ILI9341_ResetStats(void);
+
+//------------ILI9341_Cycles------------
+// Read the Cortex-M4 cycle counter, started by the init
+// functions, for timing display work.
+// Input: none
+// Output: bus cycles, 12.5 ns each at 80 MHz; wraps every 53 s
+uint32_t ILI9341_Cycles(void);
+
+//------------ILI9341_BatchBegin------------
+// Start drawing into a region off the glass.  Until
+// ILI9341_BatchEnd(), ILI9341_FillRect(), ILI9341_FillScreen(),
+// ILI9341_DrawPixel(), ILI9341_DrawFastVLine(),
+// ILI9341_DrawFastHLine(), ILI9341_Line(), ILI9341_DrawCharS(),
+// ILI9341_DrawChar(), ILI9341_DrawString() and
+// ILI9341_DrawBitmap() are recorded (up to ILI9341_BATCH_OPS of
+// them) and painted into a RAM tile when the batch ends.  Other
+// drawing functions go straight to the glass and are covered by
+// the region when the batch ends.
+// Input: x       horizontal position of the top left corner of the region, columns from the left edge
+//        y       vertical position of the top left corner of the region, rows from the top edge
+//        w       width of the region
+//        h       height of the region
+//        bgColor color of the region where nothing is drawn
+// Output: none
+// If ILI9341_TILES is 0 the region is cleared and the drawing
+// functions draw directly.
+void ILI9341_BatchBegin(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t bgColor);
+
+//------------ILI9341_BatchEnd------------
+// Paint the primitives recorded since ILI9341_BatchBegin() and
+// send the region, a band of rows at a time, each through one
+// address window.
+// Requires (11*bands + 2*w*h) bytes of transmission
+// Input: none
+// Output: none
+void ILI9341_BatchEnd(void);
+
 //------------ILI9341_DrawPixel------------
 // Color the pixel at the given coordinates with the given color.
 // Requires 13 bytes of transmission
@@ -194,6 +440,8 @@ uint16_t ILI9341_Color565(uint8_t r, uint8_t g, uint8_t b);
 
 //------------vGL2ILI_Color------------
 // Pass R (5-bit) ,G (6-bit) ,B (5-bit) and get back 16-bit packed color. (for interface with LittlevGL)
+// This is the same layout as lv_color_t.full, so LittlevGL buffers
+// need no conversion.
 // Input: r red value
 //        g green value
 //        b blue value
@@ -229,14 +477,67 @@ uint16_t ILI9341_SwapColor(uint16_t x) ;
 // Must be less than or equal to 128 pixels wide by 160 pixels high
 void ILI9341_DrawBitmap(int16_t x, int16_t y, const uint16_t *image, int16_t w, int16_t h);
 
+
+//------------ILI9341_DrawBitmapRLE------------
+// Displays a run-length encoded 16-bit color image, decoding it
+// straight into the SSI stream.  The image is stored top row
+// first, left to right, as packets of halfwords; a packet may
+// continue onto the next row.
+//   0nnnnnnn nnnnnnnn, c         n copies of color c
+//   1nnnnnnn nnnnnnnn, c1 ... cn n colors sent as they are
+// Bitmaps/lvimg2ili.py makes these arrays.  Parts of the image
+// off the screen are decoded and dropped.
+// Requires (11 + 2*w*h) bytes of transmission (assuming image fully on screen)
+// Input: x     horizontal position of the top left corner of the image, columns from the left edge
+//        y     vertical position of the top left corner of the image, rows from the top edge
+//        rle   pointer to the packets
+//        w     number of pixels wide
+//        h     number of pixels tall
+// Output: none
+void ILI9341_DrawBitmapRLE(int16_t x, int16_t y, const uint16_t *rle, int16_t w, int16_t h);
+
+
+//------------ILI9341_DrawBitmapPal8------------
+// Displays an image of 8-bit indices into a palette of up to 256
+// 16-bit colors, top row first, left to right, one byte per
+// pixel.  Each index is looked up as it is sent.
+// Bitmaps/lvimg2ili.py makes these arrays.
+// Requires (11 + 2*w*h) bytes of transmission (assuming image fully on screen)
+// Input: x       horizontal position of the top left corner of the image, columns from the left edge
+//        y       vertical position of the top left corner of the image, rows from the top edge
+//        palette pointer to the 16-bit colors
+//        index   pointer to the w*h indices
+//        w       number of pixels wide
+//        h       number of pixels tall
+// Output: none
+void ILI9341_DrawBitmapPal8(int16_t x, int16_t y, const uint16_t *palette, const uint8_t *index, int16_t w, int16_t h);
+
+
+//------------ILI9341_DrawBitmapPal4------------
+// Displays an image of 4-bit indices into a palette of up to 16
+// 16-bit colors, top row first, left to right, two pixels per
+// byte with the left pixel in the high nibble.  Every row starts
+// on a new byte, so a row takes (w+1)/2 bytes.
+// Bitmaps/lvimg2ili.py makes these arrays.
+// Requires (11 + 2*w*h) bytes of transmission (assuming image fully on screen)
+// Input: x       horizontal position of the top left corner of the image, columns from the left edge
+//        y       vertical position of the top left corner of the image, rows from the top edge
+//        palette pointer to the 16-bit colors
+//        index   pointer to the h*((w+1)/2) bytes of indices
+//        w       number of pixels wide
+//        h       number of pixels tall
+// Output: none
+void ILI9341_DrawBitmapPal4(int16_t x, int16_t y, const uint16_t *palette, const uint8_t *index, int16_t w, int16_t h);
+
 //------------ILI9341_DrawCharS------------
 // Simple character draw function.  This is the same function from
-// Adafruit_GFX.c but adapted for this processor.  However, each call
-// to ILI9341_DrawPixel() calls setAddrWindow(), which needs to send
-// many extra data and commands.  If the background color is the same
-// as the text color, no background will be printed, and text can be
-// drawn right over existing images without covering them with a box.
-// Requires (11 + 2*size*size)*6*8 (image fully on screen; textcolor != bgColor)
+// Adafruit_GFX.c but adapted for this processor.  A character that
+// is fully on the screen is sent through one address window, with
+// the background.  If the background color is the same as the
+// text color, no background will be printed, and text can be
+// drawn right over existing images without covering them with a
+// box; then each lit pixel is drawn separately.
+// Requires (11 + 2*size*size*6*8) bytes of transmission (image fully on screen; textcolor != bgColor)
 // Input: x         horizontal position of the top left corner of the character, columns from the left edge
 //        y         vertical position of the top left corner of the character, rows from the top edge
 //        c         character to be printed
@@ -264,7 +565,9 @@ void ILI9341_DrawChar(int16_t x, int16_t y, char c, int16_t textColor, int16_t b
 //------------ILI9341_DrawString------------
 // String draw function.
 // 16 rows (0 to 15) and 21 characters (0 to 20)
-// Requires (11 + size*size*6*8) bytes of transmission for each character
+// The characters that fit on the line are sent through one
+// address window.
+// Requires (11 + 2*6*8*n) bytes of transmission for n characters
 // Input: x         columns from the left edge (0 to 20)
 //        y         rows from the top edge (0 to 15)
 //        pt        pointer to a null terminated string to be printed
@@ -294,13 +597,65 @@ void ILI9341_SetCursor(uint32_t newX, uint32_t newY);
 void ILI9341_OutUDec(uint32_t n);
 
 
+//------------ILI9341_SetOrientation------------
+// Change the image rotation and mirroring.  The panel reorders
+// the pixels itself, so windows are always filled left to right,
+// top to bottom in the new orientation.
+// Requires 2 bytes of transmission
+// Input: m      new rotation value (0 to 3)
+//        mirror ILI9341_MIRROR_X to flip left-right,
+//               ILI9341_MIRROR_Y to flip top-bottom, or both
+// Output: none
+void ILI9341_SetOrientation(uint8_t m, uint8_t mirror);
+
 //------------ILI9341_SetRotation------------
-// Change the image rotation.
+// Change the image rotation, keeping the mirroring set by
+// ILI9341_SetOrientation().
 // Requires 2 bytes of transmission
 // Input: m new rotation value (0 to 3)
 // Output: none
 void ILI9341_SetRotation(uint8_t m) ;
 
+//------------ILI9341_SetScrollRegion------------
+// Define the rows that scroll with ILI9341_Scroll().  The rows
+// above and below stay fixed.  The scrolling area runs across
+// the whole width of the panel.  Scrolling starts at offset 0.
+// Requires 9 bytes of transmission
+// Input: top    first row of the scrolling area
+//        bottom last row of the scrolling area
+// Output: 1 if successful, 0 if the orientation does not allow it
+// Hardware scrolling moves panel rows, so it only works when
+// screen rows are panel rows (rotation 0 or 2, not mirrored
+// top-bottom relative to the panel, as ILI9341_DEFAULT_MIRROR
+// gives).  Call ILI9341_SetScrollRegion(0, 319) to go back to an
+// unscrolled screen.
+int ILI9341_SetScrollRegion(uint16_t top, uint16_t bottom);
+
+//------------ILI9341_Scroll------------
+// Scroll the area set by ILI9341_SetScrollRegion() up by the
+// given number of rows.  Nothing is redrawn: the rows scrolled
+// out at the top come back at the bottom, and the caller draws
+// the new rows there, using ILI9341_ScrollRow() to find them.
+// Requires 3 bytes of transmission
+// Input: lines rows to scroll up (negative scrolls down)
+// Output: none
+void ILI9341_Scroll(int16_t lines);
+
+//------------ILI9341_ScrollRow------------
+// Find the panel row that is shown at a screen row, so that
+// drawing functions called with the result appear at that row.
+// Input: y screen row
+// Output: row to draw at; y itself outside the scrolling area
+uint16_t ILI9341_ScrollRow(uint16_t y);
+
+//------------ILI9341_ScrollRows------------
+// Count the screen rows, starting at y, that are shown by
+// consecutive panel rows, so one address window can cover them.
+// Input: y screen row
+// Output: number of rows from y up to the next edge of the
+//         scrolling area or the point where it wraps
+uint16_t ILI9341_ScrollRows(uint16_t y);
+
 
 //------------ILI9341_InvertDisplay------------
 // Send the command to invert all of the colors.
@@ -309,6 +664,48 @@ void ILI9341_SetRotation(uint8_t m) ;
 // Output: none
 void ILI9341_InvertDisplay(int i) ;
 
+//------------ILI9341_SetPartialArea------------
+// Keep only the rows from top to bottom lit.  The panel stops
+// showing the rest of the screen but keeps its memory, so
+// ILI9341_NormalMode() brings the whole screen back as it was,
+// without redrawing.  Drawing outside the area still goes into
+// the panel memory and shows up after ILI9341_NormalMode().
+// Requires 7 bytes of transmission
+// Input: top    first screen row of the area
+//        bottom last screen row of the area
+// Output: 1 if successful, 0 if the orientation does not allow it
+// The area is a band of panel rows, so it only works in
+// rotation 0 or 2.
+int ILI9341_SetPartialArea(uint16_t top, uint16_t bottom);
+
+//------------ILI9341_NormalMode------------
+// Light the whole screen again after ILI9341_SetPartialArea().
+// Requires 1 byte of transmission, 4 if a scrolling area is set
+// Input: none
+// Output: none
+void ILI9341_NormalMode(void);
+
+//------------ILI9341_IdleMode------------
+// Switch the panel to 8 colors to save power: red, green and
+// blue are each fully on or off, by the top bit of their field.
+// The panel memory keeps the full colors, so turning idle mode
+// off restores the picture without redrawing.
+// Requires 1 byte of transmission
+// Input: on 0 for full color; non-zero for 8 colors
+// Output: none
+void ILI9341_IdleMode(int on);
+
+//------------ILI9341_Sleep------------
+// Put the panel to sleep, with the screen dark and the panel
+// memory and settings kept, or wake it up with the picture it
+// had.  Waits the 5 ms the panel needs before its next command.
+// Requires 1 byte of transmission
+// Input: on non-zero to sleep; 0 to wake up
+// Output: none
+// The panel needs 120 ms after waking up before it can sleep
+// again.
+void ILI9341_Sleep(int on);
+
 // graphics routines
 // y coordinates 0 to 31 used for labels and messages
 // y coordinates 32 to 159  128 pixels high
@@ -323,21 +720,21 @@ void ILI9341_PlotClear(int32_t ymin, int32_t ymax);
 
 // *************** ILI9341_PlotPoint ********************
 // Used in the voltage versus time plot, plot one point at y
-// It does output to display
+// It does not output to display until ILI9341_PlotNext called
 // Inputs: y is the y coordinate of the point plotted
 // Outputs: none
 void ILI9341_PlotPoint(int32_t y);
 
 // *************** ILI9341_PlotLine ********************
 // Used in the voltage versus time plot, plot line to new point
-// It does output to display
+// It does not output to display until ILI9341_PlotNext called
 // Inputs: y is the y coordinate of the point plotted
 // Outputs: none
 void ILI9341_PlotLine(int32_t y);
 
 // *************** ILI9341_PlotPoints ********************
 // Used in the voltage versus time plot, plot two points at y1, y2
-// It does output to display
+// It does not output to display until ILI9341_PlotNext called
 // Inputs: y1 is the y coordinate of the first point plotted
 //         y2 is the y coordinate of the second point plotted
 // Outputs: none
@@ -345,7 +742,7 @@ void ILI9341_PlotPoints(int32_t y1,int32_t y2);
 
 // *************** ILI9341_PlotBar ********************
 // Used in the voltage versus time bar, plot one bar at y
-// It does not output to display until RIT128x96x4ShowPlot called
+// It does not output to display until ILI9341_PlotNext called
 // Inputs: y is the y coordinate of the bar plotted
 // Outputs: none
 void ILI9341_PlotBar(int32_t y);
@@ -353,7 +750,7 @@ void ILI9341_PlotBar(int32_t y);
 // *************** ILI9341_PlotdBfs ********************
 // Used in the amplitude versus frequency plot, plot bar point at y
 // 0 to 0.625V scaled on a log plot from min to max
-// It does output to display
+// It does not output to display until ILI9341_PlotNext called
 // Inputs: y is the y ADC value of the bar plotted
 // Outputs: none
 void ILI9341_PlotdBfs(int32_t y);
@@ -361,17 +758,26 @@ void ILI9341_PlotdBfs(int32_t y);
 // *************** ILI9341_PlotNext ********************
 // Used in all the plots to step the X coordinate one pixel
 // X steps from 0 to 127, then back to 0 again
-// It does not output to display
+// It outputs column X, background included, to the display as
+// one 1 by 128 window
 // Inputs: none
 // Outputs: none
 void ILI9341_PlotNext(void);
 
+//------------ILI9341_Line------------
+// Draw a line of one pixel width between two points.
+// Requires 13 bytes of transmission per pixel
+// Input: x1,y1 one end of the line
+//        x2,y2 other end of the line
+//        color 16-bit color, which can be produced by ILI9341_Color565()
+// Output: none
 void ILI9341_Line(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t color);
 
 // *************** ILI9341_PlotNextErase ********************
 // Used in all the plots to step the X coordinate one pixel
 // X steps from 0 to 127, then back to 0 again
-// It clears the vertical space into which the next pixel will be drawn
+// It outputs column X; every column is sent with its background,
+// so the space for the next pixel is always clear
 // Inputs: none
 // Outputs: none
 void ILI9341_PlotNextErase(void);
@@ -432,10 +838,22 @@ void ILI9341_OutChar(char ch);
 // Position determined by ILI9341_SetCursor command
 // Color set by ILI9341_SetTextColor
 // The string will not automatically wrap.
+// Characters up to the next control character or the end of the
+// line are sent through one address window.
 // inputs: ptr  pointer to NULL-terminated ASCII string
 // outputs: none
 void ILI9341_OutString(char *ptr);
 
+//********ILI9341_OutScroll*****************
+// Choose what ILI9341_OutChar() does with a new line on the last
+// text line.  When on, the whole screen is made the scrolling
+// area and the console moves up one line with a single command,
+// and only the new line is cleared.  When off, the cursor wraps
+// to the top line (default).
+// inputs: on  0 to wrap, nonzero to scroll
+// outputs: 1 if successful, 0 if the orientation does not allow scrolling
+int ILI9341_OutScroll(int on);
+
 // ************** ILI9341_SetTextColor ************************
 // Sets the color in which the characters will be printed
 // Background color is fixed at black
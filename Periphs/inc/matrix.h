@@ -54,4 +54,7 @@ void Matrix_Init(void);
 // spin if Fifo is empty
 char Matrix_InChar(void);
 
+// number of keys waiting in the Fifo
+int Matrix_Pending(void);
+
 char numpad2TextInput(char input, int* deletePrev);
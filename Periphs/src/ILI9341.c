@@ -92,6 +92,7 @@
 #include <stdint.h>
 #include "../inc/ILI9341.h"
 #include "../../../inc/tm4c123gh6pm.h"
+#include "../inc/FIFO.h"
 
 // 16 rows (0 to 15) and 21 characters (0 to 20)
 // Requires (11 + size*size*6*8) bytes of transmission for each character
@@ -119,6 +120,10 @@ uint16_t StTextColor = ILI9341_YELLOW;
 #define ILI9341_RAMRD   0x2E
 
 #define ILI9341_PTLAR   0x30
+#define ILI9341_VSCRDEF 0x33
+#define ILI9341_VSCRSADD 0x37
+#define ILI9341_IDMOFF  0x38
+#define ILI9341_IDMON   0x39
 #define ILI9341_COLMOD  0x3A
 #define ILI9341_MADCTL  0x36
 
@@ -145,13 +150,15 @@ uint16_t StTextColor = ILI9341_YELLOW;
 #define ILI9341_GMCTRP1 0xE0
 #define ILI9341_GMCTRN1 0xE1
 
+#ifndef TFT_CS                          // Emulator/inc/tm4c123gh6pm.h has host versions
 #define TFT_CS                  (*((volatile uint32_t *)0x40004020))
+#define DC                      (*((volatile uint32_t *)0x40004100))
+#define RESET                   (*((volatile uint32_t *)0x40004200))
+#endif
 #define TFT_CS_LOW              0           // CS normally controlled by hardware
 #define TFT_CS_HIGH             0x08
-#define DC                      (*((volatile uint32_t *)0x40004100))
 #define DC_COMMAND              0
 #define DC_DATA                 0x40
-#define RESET                   (*((volatile uint32_t *)0x40004200))
 #define RESET_LOW               0
 #define RESET_HIGH              0x80
 
@@ -162,6 +169,7 @@ uint16_t StTextColor = ILI9341_YELLOW;
 #define SSI_CR0_FRF_MOTO        0x00000000  // Freescale SPI Frame Format
 #define SSI_CR0_DSS_M           0x0000000F  // SSI Data Size Select
 #define SSI_CR0_DSS_8           0x00000007  // 8-bit data
+#define SSI_CR0_DSS_16          0x0000000F  // 16-bit data
 #define SSI_CR1_MS              0x00000004  // SSI Master/Slave Select
 #define SSI_CR1_SSE             0x00000002  // SSI Synchronous Serial Port
                                             // Enable
@@ -197,6 +205,10 @@ uint16_t StTextColor = ILI9341_YELLOW;
 #define ILI9341_RAMRD   0x2E
 
 #define ILI9341_PTLAR   0x30
+#define ILI9341_VSCRDEF 0x33
+#define ILI9341_VSCRSADD 0x37
+#define ILI9341_IDMOFF  0x38
+#define ILI9341_IDMON   0x39
 #define ILI9341_COLMOD  0x3A
 #define ILI9341_MADCTL  0x36
 
@@ -484,9 +496,24 @@ static const uint8_t Font[] = {
 };
 
 
+#define MADCTL_MY  0x80
+#define MADCTL_MX  0x40
+#define MADCTL_MV  0x20
+#define MADCTL_ML  0x10
+#define MADCTL_RGB 0x00
+#define MADCTL_BGR 0x08
+#define MADCTL_MH  0x04
+
 static uint8_t ColStart, RowStart; // some displays need this changed
 static uint8_t Rotation;           // 0 to 3
+static uint8_t Mirror;             // ILI9341_MIRROR_X and/or ILI9341_MIRROR_Y
 static enum initRFlags TabColor;
+static uint8_t ColorOrder;         // MADCTL color bit, MADCTL_BGR on the black tab panel
+static uint8_t Madctl;             // MADCTL orientation bits set by ILI9341_SetOrientation()
+static uint16_t ScrollTop;         // first row of the vertical scrolling area
+static uint16_t ScrollHeight;      // rows in the vertical scrolling area, 0 if none
+static uint16_t ScrollOffset;      // 0 to ScrollHeight-1, rows scrolled up
+static uint8_t ConsoleScroll;      // nonzero if ILI9341_OutChar() scrolls instead of wrapping
 static int16_t _width = ILI9341_TFTWIDTH;   // this could probably be a constant, except it is used in Adafruit_GFX and depends on image rotation
 static int16_t _height = ILI9341_TFTHEIGHT;
 
@@ -506,23 +533,576 @@ static int16_t _height = ILI9341_TFTHEIGHT;
 // The write data operation waits until there is room in the
 // transmit FIFO, configures the Data/Command pin for data,
 // and then adds the data to the transmit FIFO.
+// Blocking writes must not be mixed into queued operations, so
+// the write command operation first waits for the operation
+// queue (see SSI0_Handler()) to empty.  Every blocking drawing
+// function starts with a command, so writedata() does not need
+// to check.
+// In ILI9341_PIXELS_16BIT mode the SSI is switched to 16-bit
+// frames after the RAMWR command (see setAddrWindow()), and
+// the write command operation switches it back to 8-bit frames.
+// Pixels are sent with writepixel(), never writedata().
 // NOTE: These functions will crash or stall indefinitely if
 // the SSI0 module is not initialized and enabled.
+static volatile uint32_t DmaBusy;       // nonzero while the operation queue is being sent
+static enum ILI9341_PixelMode PixelMode = ILI9341_PIXELS_8BIT;
+static uint8_t FrameBits = 8;           // current SSI0 frame size, 8 or 16
+static const uint8_t SpeedCpsr[3] = {   // CPSDVSR of each enum ILI9341_Speed
+  10, 6, 4
+};
+
+// Data Watchpoint and Trace unit cycle counter
+#ifndef DWT_CYCCNT_R                    // Emulator/inc/tm4c123gh6pm.h has host versions
+#define DEMCR_R         (*((volatile uint32_t *)0xE000EDFC))
+#define DWT_CTRL_R      (*((volatile uint32_t *)0xE0001000))
+#define DWT_CYCCNT_R    (*((volatile uint32_t *)0xE0001004))
+#endif
+#define DEMCR_TRCENA    0x01000000      // enable DWT
+#define DWT_CTRL_CYCCNTENA 0x00000001   // enable CYCCNT
+
+#if ILI9341_STATS
+static ILI9341_Stats_t Stats;
+#define STAT_ADD(field, n) (Stats.field += (n))
+// Spin while cond (which has no side effects) is true, and add
+// the time to the busy-wait count; free when there is no wait
+#define STAT_WAIT(cond) do{ \
+  if(cond){ \
+    uint32_t t0 = DWT_CYCCNT_R; \
+    while(cond){} \
+    Stats.waitCycles += DWT_CYCCNT_R - t0; \
+  } \
+}while(0)
+#else
+#define STAT_ADD(field, n)
+#define STAT_WAIT(cond) do{ \
+  while(cond){} \
+}while(0)
+#endif
+
+// Change the SSI0 frame size; the SSI must be idle
+void static setFrameBits(uint8_t bits) {
+  STAT_WAIT((SSI0_SR_R&SSI_SR_BSY)==SSI_SR_BSY);
+  SSI0_CR1_R &= ~SSI_CR1_SSE;           // disable SSI
+  if(bits == 16){
+    SSI0_CR0_R = (SSI0_CR0_R&~SSI_CR0_DSS_M)+SSI_CR0_DSS_16;
+  } else{
+    SSI0_CR0_R = (SSI0_CR0_R&~SSI_CR0_DSS_M)+SSI_CR0_DSS_8;
+  }
+  SSI0_CR1_R |= SSI_CR1_SSE;            // enable SSI
+  FrameBits = bits;
+}
+
 void static writecommand(uint8_t c) {
+  STAT_WAIT(DmaBusy);                   // wait for queued operations to be sent
+  if(FrameBits != 8){
+    setFrameBits(8);                    // commands and parameters are bytes
+  }
                                         // wait until SSI0 not busy/transmit FIFO empty
-  while((SSI0_SR_R&SSI_SR_BSY)==SSI_SR_BSY){};
+  STAT_WAIT((SSI0_SR_R&SSI_SR_BSY)==SSI_SR_BSY);
   DC = DC_COMMAND;
   SSI0_DR_R = c;                        // data out
+  STAT_ADD(commands, 1);
                                         // wait until SSI0 not busy/transmit FIFO empty
-  while((SSI0_SR_R&SSI_SR_BSY)==SSI_SR_BSY){};
+  STAT_WAIT((SSI0_SR_R&SSI_SR_BSY)==SSI_SR_BSY);
 }
 
 
 void static writedata(uint8_t c) {
-  while((SSI0_SR_R&SSI_SR_TNF)==0){};   // wait until transmit FIFO not full
+  STAT_WAIT((SSI0_SR_R&SSI_SR_TNF)==0); // wait until transmit FIFO not full
   DC = DC_DATA;
   SSI0_DR_R = c;                        // data out
+  STAT_ADD(dataBytes, 1);
+}
+
+
+// Send one pixel, most significant byte first, into the window
+// opened by setAddrWindow(), which has already set the
+// Data/Command pin for data.  One FIFO push per pixel in
+// 16-bit frames, two in 8-bit frames.
+void static writepixel(uint16_t color) {
+  if(FrameBits == 16){
+    STAT_WAIT((SSI0_SR_R&SSI_SR_TNF)==0); // wait until transmit FIFO not full
+    SSI0_DR_R = color;                  // data out
+  } else{
+    STAT_WAIT((SSI0_SR_R&SSI_SR_TNF)==0);
+    SSI0_DR_R = color >> 8;             // send the top 8 bits
+    STAT_WAIT((SSI0_SR_R&SSI_SR_TNF)==0);
+    SSI0_DR_R = color&0xFF;             // send the bottom 8 bits
+  }
+  STAT_ADD(dataBytes, 2);
+}
+#if ILI9341_USE_UDMA
+// uDMA channel 11 (encoding 0) moves pixel data from RAM into the
+// SSI0 transmit FIFO.  The uDMA completion interrupt for a
+// peripheral channel arrives on that peripheral's vector, so
+// SSI0_Handler() finishes the block.  One transfer moves at most
+// 1024 items, so longer blocks are sent as chunks, each started
+// from the interrupt.
+#define DMA_SSI0TX_CH           11          // SSI0 TX channel
+#define DMA_SSI0TX_BIT          (1<<DMA_SSI0TX_CH)
+#define DMA_MAXXFER             1024        // items per uDMA transfer
+#define DMA_DSTINC_NONE         0xC0000000  // destination is SSI0_DR_R
+#define DMA_DSTSIZE_8           0x00000000  // 8-bit destination data
+#define DMA_DSTSIZE_16          0x10000000  // 16-bit destination data
+#define DMA_SRCINC_8            0x00000000  // 8-bit source increment
+#define DMA_SRCINC_16           0x04000000  // 16-bit source increment
+#define DMA_SRCINC_NONE         0x0C000000  // same source item every time
+#define DMA_SRCSIZE_8           0x00000000  // 8-bit source data
+#define DMA_SRCSIZE_16          0x01000000  // 16-bit source data
+#define DMA_ARBSIZE_4           0x00008000  // 4 items per arbitration (FIFO half empty)
+#define DMA_XFERMODE_BASIC      0x00000001  // basic mode
+#define SSI_DMACTL_TXDMAE       0x00000002  // SSI0 TX uDMA enable
+#define SSI_CR1_EOT             0x00000010  // TXRIS means transmitter idle
+#define SSI_IM_TXIM             0x00000008  // transmit interrupt mask
+#define SSI_MIS_TXMIS           0x00000008  // masked transmit interrupt
+
+// channel control table, 1024-byte aligned, primary structures only
+static uint32_t ucControlTable[256] __attribute__ ((aligned(1024)));
+static uint32_t DmaInc;                 // 0 to send the same item every time
+#endif
+static const uint8_t *DmaSrc;           // next item to send
+static uint32_t DmaLeft;                // items left after the current chunk
+static uint32_t DmaItem;                // bytes per item, 1 or 2 (SSI frame size)
+
+#if ILI9341_USE_UDMA
+// Program and start the next chunk of the current block
+void static dmaStart(void){
+  uint32_t n = DmaLeft;
+  uint32_t size;
+  if(n > DMA_MAXXFER) n = DMA_MAXXFER;
+  if(DmaItem == 2){
+    size = DMA_DSTSIZE_16|DMA_SRCSIZE_16|(DmaInc ? DMA_SRCINC_16 : DMA_SRCINC_NONE);
+  } else{
+    size = DMA_DSTSIZE_8|DMA_SRCSIZE_8|(DmaInc ? DMA_SRCINC_8 : DMA_SRCINC_NONE);
+  }
+  if(DmaInc){
+    ucControlTable[DMA_SSI0TX_CH*4] = (uint32_t)(DmaSrc + (n-1)*DmaItem); // source end
+  } else{
+    ucControlTable[DMA_SSI0TX_CH*4] = (uint32_t)DmaSrc;                   // fixed source
+  }
+  ucControlTable[DMA_SSI0TX_CH*4+1] = (uint32_t)&SSI0_DR_R;               // destination end
+  ucControlTable[DMA_SSI0TX_CH*4+2] = DMA_DSTINC_NONE|size|DMA_ARBSIZE_4|((n-1)<<4)|DMA_XFERMODE_BASIC;
+  if(DmaInc){
+    DmaSrc = DmaSrc + n*DmaItem;
+  }
+  DmaLeft = DmaLeft - n;
+  STAT_ADD(dataBytes, n*DmaItem);
+  UDMA_ENASET_R = DMA_SSI0TX_BIT;       // SSI0 requests move the data
+}
+
+// Activate uDMA for SSI0 TX; called once SSI0 is running
+void static dmaInit(void){
+  SYSCTL_RCGCDMA_R |= 0x01;             // activate uDMA
+  while((SYSCTL_PRDMA_R&0x01)==0){};    // allow time for clock to start
+  UDMA_CFG_R = 0x01;                    // enable uDMA controller
+  UDMA_CTLBASE_R = (uint32_t)ucControlTable;
+  UDMA_CHMAP1_R = UDMA_CHMAP1_R&0xFFFF0FFF; // channel 11 encoding 0 is SSI0 TX
+  UDMA_PRIOCLR_R = DMA_SSI0TX_BIT;      // default priority
+  UDMA_ALTCLR_R = DMA_SSI0TX_BIT;       // use primary control structure
+  UDMA_USEBURSTCLR_R = DMA_SSI0TX_BIT;  // respond to single and burst requests
+  UDMA_REQMASKCLR_R = DMA_SSI0TX_BIT;   // allow SSI0 to request transfers
+  SSI0_DMACTL_R |= SSI_DMACTL_TXDMAE;   // TX FIFO space requests uDMA
+  SSI0_IM_R &= ~SSI_IM_TXIM;            // transmit interrupt only while the queue waits for idle
+  NVIC_PRI1_R = (NVIC_PRI1_R&0x1FFFFFFF)|0x60000000; // SSI0 priority 3
+  NVIC_EN0_R = 1<<7;                    // enable IRQ 7 (SSI0) for uDMA completion
+}
+
+
+// Display operation queue.  In asynchronous mode (see
+// ILI9341_SetAsync()) drawing functions encode their work as
+// an operation and return.  SSI0_Handler() sends the queue in
+// the background: the command bytes of the address window are
+// written to the FIFO and the transmitter idle (EOT) interrupt
+// says when the Data/Command pin may change, and the pixels are
+// moved by the uDMA in 16-bit frames.  Blocking drawing
+// functions wait for the queue to empty in writecommand().
+enum dispOpType{
+  OP_PIXELS,                    // count pixels from src
+  OP_FILL,                      // count copies of color
+  OP_BITMAP                     // rows of count pixels, stride halfwords apart
+};
+typedef struct{
+  uint8_t type;                 // enum dispOpType
+  uint8_t window;               // nonzero to send CASET/RASET/RAMWR first
+  uint8_t item;                 // bytes per SSI frame, 1 or 2
+  uint16_t x0, y0, x1, y1;      // address window, column/row offsets added
+  uint16_t color;               // OP_FILL color
+  const uint16_t *src;          // OP_PIXELS/OP_BITMAP data
+  uint32_t count;               // items, or pixels per row for OP_BITMAP
+  uint16_t rows;                // OP_BITMAP rows
+  int32_t stride;               // OP_BITMAP halfwords from one row to the next
+  void (*done)(void);           // called from SSI0_Handler() when src is free
+} dispOp_t;
+#define DISPOP_FIFOSIZE 16      // must be a power of 2
+AddIndexFifo(DispOp, DISPOP_FIFOSIZE, dispOp_t, 1, 0)
+
+enum opPhase{
+  PH_NEXT,                      // waiting for idle to start the next operation
+  PH_START,                     // Op loaded, waiting for idle to start it
+  PH_CASET, PH_CASET_ARGS, PH_RASET, PH_RASET_ARGS, PH_RAMWR,
+  PH_PAYLOAD,                   // waiting for idle to send the pixels
+  PH_DMA                        // uDMA is moving the pixels
+};
+static dispOp_t Op;             // operation being sent
+static uint8_t Phase;           // enum opPhase
+static uint16_t RowsLeft;       // OP_BITMAP rows after the current one
+static uint8_t Async;           // nonzero if drawing functions queue their work
+
+// Ask for an interrupt once the SSI has sent its last bit
+#define waitIdle() (SSI0_IM_R |= SSI_IM_TXIM)
+
+// Load the pixels of Op, or of its next bitmap row, into the uDMA
+void static opPayload(void){
+  DmaItem = Op.item;
+  if(Op.type == OP_FILL){
+    DmaSrc = (const uint8_t *)&Op.color;
+    DmaInc = 0;
+  } else{
+    DmaSrc = (const uint8_t *)Op.src;
+    DmaInc = 1;
+  }
+  DmaLeft = Op.count;
+  Phase = PH_DMA;
+  dmaStart();
+}
+
+// Send the next part of Op; called from SSI0_Handler() with SSI0 idle
+void static opStep(void){
+  switch(Phase){
+  case PH_NEXT:
+    if(DispOpFifo_Get(&Op) == 0){
+      DmaBusy = 0;                      // queue empty
+      return;
+    }
+    // fall through
+  case PH_START:
+    RowsLeft = (Op.type == OP_BITMAP) ? Op.rows - 1 : 0;
+    if(Op.window == 0){
+      Phase = PH_PAYLOAD;
+      opStep();
+      return;
+    }
+    if(FrameBits != 8) setFrameBits(8);
+    STAT_ADD(windows, 1);
+    STAT_ADD(commands, 3);              // CASET, RASET, RAMWR
+    STAT_ADD(dataBytes, 8);
+    DC = DC_COMMAND;
+    SSI0_DR_R = ILI9341_CASET;
+    Phase = PH_CASET_ARGS;
+    break;
+  case PH_CASET_ARGS:
+    DC = DC_DATA;
+    SSI0_DR_R = Op.x0>>8; SSI0_DR_R = Op.x0&0xFF;
+    SSI0_DR_R = Op.x1>>8; SSI0_DR_R = Op.x1&0xFF;
+    Phase = PH_RASET;
+    break;
+  case PH_RASET:
+    DC = DC_COMMAND;
+    SSI0_DR_R = ILI9341_RASET;
+    Phase = PH_RASET_ARGS;
+    break;
+  case PH_RASET_ARGS:
+    DC = DC_DATA;
+    SSI0_DR_R = Op.y0>>8; SSI0_DR_R = Op.y0&0xFF;
+    SSI0_DR_R = Op.y1>>8; SSI0_DR_R = Op.y1&0xFF;
+    Phase = PH_RAMWR;
+    break;
+  case PH_RAMWR:
+    DC = DC_COMMAND;
+    SSI0_DR_R = ILI9341_RAMWR;
+    Phase = PH_PAYLOAD;
+    break;
+  default:                              // PH_PAYLOAD
+    DC = DC_DATA;
+    if(FrameBits != 8*Op.item) setFrameBits(8*Op.item);
+    opPayload();
+    return;                             // uDMA interrupt comes next
+  }
+  waitIdle();
+}
+
+// Fill in the address window of an operation
+void static opWindow(dispOp_t *op, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1){
+  op->window = 1;
+  op->x0 = x0+ColStart;
+  op->x1 = x1+ColStart;
+  op->y0 = y0+RowStart;
+  op->y1 = y1+RowStart;
 }
+
+// Add an operation to the queue and start the queue if it is idle.
+// Spins while the queue is full, so it must not be called from an
+// interrupt at or above the SSI0 priority.
+void static opQueue(const dispOp_t *op){
+  long sr;
+#if ILI9341_STATS
+  uint32_t t0;
+  if(DispOpFifo_Put(*op) == 0){         // queue full
+    t0 = DWT_CYCCNT_R;
+    while(DispOpFifo_Put(*op) == 0){};
+    Stats.waitCycles += DWT_CYCCNT_R - t0;
+  }
+#else
+  while(DispOpFifo_Put(*op) == 0){};
+#endif
+  sr = StartCritical();
+  if(DmaBusy == 0){
+    DmaBusy = 1;
+    Phase = PH_NEXT;
+    waitIdle();                         // interrupts as soon as SSI0 is idle
+  }
+  EndCritical(sr);
+}
+
+// uDMA completion for channel 11 and SSI0 transmitter idle
+void SSI0_Handler(void){
+  if(UDMA_CHIS_R&DMA_SSI0TX_BIT){
+    UDMA_CHIS_R = DMA_SSI0TX_BIT;       // acknowledge
+    if(DmaLeft){
+      dmaStart();                       // next chunk
+    } else if(RowsLeft){
+      RowsLeft--;                       // next bitmap row
+      Op.src = Op.src + Op.stride;
+      opPayload();
+    } else{
+      uint8_t item = Op.item;
+      if(Op.done) Op.done();
+      if(DispOpFifo_Get(&Op) == 0){
+        Phase = PH_NEXT;                // idle once the FIFO drains
+        waitIdle();
+      } else if((Op.window == 0) && (Op.item == item)){
+                                        // same window and frame size: keep streaming
+        RowsLeft = (Op.type == OP_BITMAP) ? Op.rows - 1 : 0;
+        opPayload();
+      } else{
+        Phase = PH_START;               // DC pin or frame size changes when idle
+        waitIdle();
+      }
+    }
+  }
+  if(SSI0_MIS_R&SSI_MIS_TXMIS){
+    SSI0_IM_R &= ~SSI_IM_TXIM;          // level interrupt, disarm until needed
+    opStep();
+  }
+}
+#endif
+
+
+//------------ILI9341_DMA_WritePixels------------
+// Send a block of pixels into the window opened by
+// ILI9341_SetWindow() without waiting for it.  In
+// ILI9341_PIXELS_16BIT mode each halfword is one native color.
+// In ILI9341_PIXELS_8BIT mode the data are sent as bytes in
+// memory order, so each halfword must hold the high byte of
+// the color first (byte-swapped 565).  The buffer must not
+// change until done() is called from the SSI0 interrupt.
+// Blocking drawing functions called in the meantime wait for
+// the block to be sent.
+// Requires 2*count bytes of transmission
+// Input: pixels pointer to the colors
+//        count  number of pixels
+//        done   function called when the buffer is free (may be 0)
+// Output: none
+// If ILI9341_USE_UDMA is 0 the pixels are sent with the CPU and
+// done() is called before returning.
+void ILI9341_DMA_WritePixels(const uint16_t *pixels, uint32_t count, void (*done)(void)){
+#if ILI9341_USE_UDMA
+  dispOp_t op;
+  if(count == 0){
+    if(done) done();
+    return;
+  }
+  op.type = OP_PIXELS;
+  op.window = 0;                        // ILI9341_SetWindow() already sent RAMWR
+  op.item = FrameBits/8;
+  op.src = pixels;
+  op.count = (op.item == 2) ? count : 2*count;
+  op.done = done;
+  opQueue(&op);
+#else
+  DC = DC_DATA;
+  DmaSrc = (const uint8_t *)pixels;
+  if(FrameBits == 16){
+    DmaItem = 2;
+    DmaLeft = count;
+  } else{
+    DmaItem = 1;
+    DmaLeft = 2*count;
+  }
+  STAT_ADD(dataBytes, DmaLeft*DmaItem);
+  while(DmaLeft){
+    STAT_WAIT((SSI0_SR_R&SSI_SR_TNF)==0); // wait until transmit FIFO not full
+    if(DmaItem == 2){
+      SSI0_DR_R = *(const uint16_t *)DmaSrc;
+    } else{
+      SSI0_DR_R = *DmaSrc;
+    }
+    DmaSrc = DmaSrc + DmaItem;
+    DmaLeft--;
+  }
+  if(done) done();
+#endif
+}
+
+
+//------------ILI9341_DMA_FillPixels------------
+// Send count copies of one color into the window opened by
+// ILI9341_SetWindow(), after any block already queued with
+// ILI9341_DMA_WritePixels(), without waiting for it.  The uDMA
+// reads the same halfword for every pixel, so no buffer is
+// needed.
+// Requires 2*count bytes of transmission
+// Input: color  16-bit color, which can be produced by ILI9341_Color565()
+//        count  number of pixels
+//        done   function called when the pixels have been queued (may be 0)
+// Output: none
+// In ILI9341_PIXELS_8BIT mode, or if ILI9341_USE_UDMA is 0, the
+// pixels are sent with the CPU and done() is called before
+// returning.
+void ILI9341_DMA_FillPixels(uint16_t color, uint32_t count, void (*done)(void)){
+#if ILI9341_USE_UDMA
+  dispOp_t op;
+  if((count != 0) && (FrameBits == 16)){
+    op.type = OP_FILL;
+    op.window = 0;                      // ILI9341_SetWindow() already sent RAMWR
+    op.item = 2;
+    op.color = color;
+    op.count = count;
+    op.done = done;
+    opQueue(&op);
+    return;
+  }
+  STAT_WAIT(DmaBusy);                   // keep the order of queued blocks
+#endif
+  DC = DC_DATA;
+  while(count){
+    writepixel(color);
+    count--;
+  }
+  if(done) done();
+}
+
+
+//------------ILI9341_SetAsync------------
+// Choose whether ILI9341_FillRect(), ILI9341_FillScreen() and
+// ILI9341_DrawBitmap() queue their work and return at once.
+// The queued operations are sent by the SSI0 interrupt, so the
+// bitmap data must stay valid until the queue is empty.  Every
+// other drawing function, and ILI9341_Async_Wait(), waits for
+// the queue to empty first, so the picture is the same as in
+// blocking mode.
+// Input: on 0 to block (default), nonzero to queue
+// Output: none
+// If ILI9341_USE_UDMA is 0 the drawing functions always block.
+void ILI9341_SetAsync(int on){
+#if ILI9341_USE_UDMA
+  Async = (on != 0);
+#else
+  (void)on;
+#endif
+}
+
+
+//------------ILI9341_Async_Wait------------
+// Wait until every queued operation has been sent.
+// Input: none
+// Output: none
+void ILI9341_Async_Wait(void){
+  STAT_WAIT(DmaBusy);
+}
+
+
+//------------ILI9341_SetPixelMode------------
+// Select how pixel data are sent after a RAMWR command.
+// ILI9341_PIXELS_8BIT sends each pixel as two 8-bit SSI frames.
+// ILI9341_PIXELS_16BIT switches SSI0 to 16-bit frames for the
+// pixels, one FIFO push per pixel, and back to 8-bit frames for
+// the next command.  The bytes on the wire are the same.
+// Input: mode ILI9341_PIXELS_8BIT or ILI9341_PIXELS_16BIT
+// Output: none
+void ILI9341_SetPixelMode(enum ILI9341_PixelMode mode){
+  while(DmaBusy){};                     // the current block keeps its frame size
+  PixelMode = mode;
+}
+
+
+//------------ILI9341_SetSpeed------------
+// Change the SSI0 clock once everything queued has been sent.
+// Faster profiles may need short wires to the panel; check the
+// picture at each one before using it.
+// Input: speed ILI9341_SPEED_SAFE, ILI9341_SPEED_FAST or ILI9341_SPEED_MAX
+// Output: SSI clock in Hz
+uint32_t ILI9341_SetSpeed(enum ILI9341_Speed speed){
+  if(speed > ILI9341_SPEED_MAX) speed = ILI9341_SPEED_MAX;
+  STAT_WAIT(DmaBusy);                   // the current block keeps its clock
+  STAT_WAIT((SSI0_SR_R&SSI_SR_BSY)==SSI_SR_BSY);
+  SSI0_CR1_R &= ~SSI_CR1_SSE;           // disable SSI
+  SSI0_CPSR_R = (SSI0_CPSR_R&~SSI_CPSR_CPSDVSR_M)+SpeedCpsr[speed];
+  SSI0_CR1_R |= SSI_CR1_SSE;            // enable SSI
+  return 80000000/SpeedCpsr[speed];
+}
+
+
+//------------ILI9341_GetPixelMode------------
+// Report the pixel mode chosen by ILI9341_SetPixelMode().
+// Input: none
+// Output: ILI9341_PIXELS_8BIT or ILI9341_PIXELS_16BIT
+enum ILI9341_PixelMode ILI9341_GetPixelMode(void){
+  return PixelMode;
+}
+
+
+//------------ILI9341_DMA_Busy------------
+// Check whether a ILI9341_DMA_WritePixels() block or any other
+// queued operation is still being sent.
+// Input: none
+// Output: nonzero while the block is in progress
+int ILI9341_DMA_Busy(void){
+  return DmaBusy;
+}
+
+
+//------------ILI9341_GetStats------------
+// Copy the traffic counters.
+// Input: stats pointer to the structure to fill in
+// Output: none
+void ILI9341_GetStats(ILI9341_Stats_t *stats){
+#if ILI9341_STATS
+  long sr = StartCritical();            // the SSI0 interrupt counts queued work
+  *stats = Stats;
+  EndCritical(sr);
+#else
+  stats->commands = stats->dataBytes = stats->windows = stats->waitCycles = 0;
+#endif
+}
+
+
+//------------ILI9341_ResetStats------------
+// Set the traffic counters to zero.
+// Input: none
+// Output: none
+void ILI9341_ResetStats(void){
+#if ILI9341_STATS
+  long sr = StartCritical();
+  Stats.commands = 0;
+  Stats.dataBytes = 0;
+  Stats.windows = 0;
+  Stats.waitCycles = 0;
+  EndCritical(sr);
+#endif
+}
+
+
+//------------ILI9341_Cycles------------
+// Read the Cortex-M4 cycle counter, started by the init
+// functions, for timing display work.
+// Input: none
+// Output: bus cycles, 12.5 ns each at 80 MHz; wraps every 53 s
+uint32_t ILI9341_Cycles(void){
+  return DWT_CYCCNT_R;
+}
+
+
 // Subroutine to wait 1 msec
 // Inputs: None
 // Outputs: None
@@ -676,37 +1256,118 @@ static const uint8_t
       100 };                  //     100 ms delay
 
 
-// Companion code to the above tables.  Reads and issues
-// a series of LCD commands stored in ROM byte array.
-void static commandList(const uint8_t *addr) {
-
-  uint8_t numCommands, numArgs;
+// Companion code to the above tables.  The panel bring-up (reset
+// pulse, then the command tables) is a sequence of steps separated
+// by delays.  initStep() issues everything up to the next delay and
+// returns its length, so the same sequence can be run blocking
+// with Delay1ms() or in the background from Timer3A one-shots.
+#define RESET_HIGH_MS  10       // RESET high before the pulse
+#define RESET_LOW_MS   10       // RESET pulse, at least 10 us
+#define RESET_WAIT_MS  120      // reset to first command, 5 ms (120 ms if asleep)
+enum initPhase{
+  IP_RESET_HIGH,                // RESET high, waiting
+  IP_RESET_LOW,                 // RESET pulse
+  IP_RESET_WAIT,                // panel resetting
+  IP_TABLES,                    // sending the command tables
+  IP_DONE
+};
+static const uint8_t *InitList[3];      // command tables, in order
+static uint8_t InitLists;               // number of tables
+static uint8_t InitIdx;                 // next table
+static const uint8_t *InitAddr;         // next byte of the current table
+static uint8_t InitCmds;                // commands left in the current table
+static uint8_t InitPhase;               // enum initPhase
+static volatile uint8_t InitRunning;    // nonzero while Timer3A runs the sequence
+static enum initRFlags InitOption;      // tab color of ILI9341_InitR_Start()
+
+// Issue the sequence up to its next delay.  Reads and issues
+// a series of LCD commands stored in ROM byte arrays.
+// Output: delay in ms before the next step, 0 when finished
+uint32_t static initStep(void){
+  uint8_t numArgs;
   uint16_t ms;
-
-  numCommands = *(addr++);               // Number of commands to follow
-  while(numCommands--) {                 // For each command...
-    writecommand(*(addr++));             //   Read, issue command
-    numArgs  = *(addr++);                //   Number of args to follow
-    ms       = numArgs & DELAY;          //   If hibit set, delay follows args
-    numArgs &= ~DELAY;                   //   Mask out delay bit
-    while(numArgs--) {                   //   For each argument...
-      writedata(*(addr++));              //     Read, issue argument
+  switch(InitPhase){
+  case IP_RESET_HIGH:
+    RESET = RESET_HIGH;
+    InitPhase = IP_RESET_LOW;
+    return RESET_HIGH_MS;
+  case IP_RESET_LOW:
+    RESET = RESET_LOW;
+    InitPhase = IP_RESET_WAIT;
+    return RESET_LOW_MS;
+  case IP_RESET_WAIT:
+    RESET = RESET_HIGH;
+    InitPhase = IP_TABLES;
+    InitIdx = 0;
+    InitCmds = 0;
+    return RESET_WAIT_MS;
+  case IP_TABLES:
+    while(1){
+      if(InitCmds == 0){                 // start the next table
+        if(InitIdx == InitLists) break;
+        InitAddr = InitList[InitIdx++];
+        InitCmds = *(InitAddr++);        // Number of commands to follow
+        continue;
+      }
+      InitCmds--;
+      writecommand(*(InitAddr++));       //   Read, issue command
+      numArgs  = *(InitAddr++);          //   Number of args to follow
+      ms       = numArgs & DELAY;        //   If hibit set, delay follows args
+      numArgs &= ~DELAY;                 //   Mask out delay bit
+      while(numArgs--) {                 //   For each argument...
+        writedata(*(InitAddr++));        //     Read, issue argument
+      }
+      if(ms) {
+        ms = *(InitAddr++);              // Read post-command delay time (ms)
+        if(ms == 255) ms = 500;          // If 255, delay for 500 ms
+        return ms;
+      }
     }
+    InitPhase = IP_DONE;
+    return 0;
+  default:                               // IP_DONE
+    return 0;
+  }
+}
 
-    if(ms) {
-      ms = *(addr++);             // Read post-command delay time (ms)
-      if(ms == 255) ms = 500;     // If 255, delay for 500 ms
-      Delay1ms(ms);
-    }
+// Run the whole sequence, waiting out each delay
+void static initRun(void){
+  uint32_t ms;
+  while((ms = initStep()) != 0){
+    Delay1ms(ms);
+  }
+}
+
+// Start Timer3A counting down ms milliseconds, once
+void static initTimer(uint32_t ms){
+  TIMER3_CTL_R = 0x00000000;            // disable TIMER3A
+  TIMER3_TAILR_R = ms*80000 - 1;        // 80 MHz bus clock
+  TIMER3_ICR_R = TIMER_ICR_TATOCINT;    // clear TIMER3A timeout flag
+  TIMER3_CTL_R = 0x00000001;            // enable TIMER3A
+}
+
+// Timer3A one-shot: the current delay of the sequence is over
+void Timer3A_Handler(void){
+  uint32_t ms;
+  TIMER3_ICR_R = TIMER_ICR_TATOCINT;    // acknowledge TIMER3A timeout
+  ms = initStep();
+  if(ms){
+    initTimer(ms);
+  } else{
+    InitRunning = 0;
   }
 }
 
 
-// Initialization code common to both 'B' and 'R' type displays
+// Hardware setup common to both 'B' and 'R' type displays; the
+// reset pulse and command tables follow in initStep()
 void static commonInit(const uint8_t *cmdList) {
-  volatile uint32_t delay;
   ColStart  = RowStart = 0; // May be overridden in init func
 
+  DEMCR_R |= DEMCR_TRCENA;              // start the cycle counter
+  DWT_CYCCNT_R = 0;
+  DWT_CTRL_R |= DWT_CTRL_CYCCNTENA;
+
   SYSCTL_RCGCSSI_R |= 0x01;  // activate SSI0
   SYSCTL_RCGCGPIO_R |= 0x01; // activate port A
   while((SYSCTL_PRGPIO_R&0x01)==0){}; // allow time for clock to start
@@ -721,11 +1382,7 @@ void static commonInit(const uint8_t *cmdList) {
   GPIO_PORTA_AMSEL_R &= ~0xC8;          // disable analog functionality on PA3,6,7
   TFT_CS = TFT_CS_LOW;
   RESET = RESET_HIGH;
-  Delay1ms(500);
-  RESET = RESET_LOW;
-  Delay1ms(500);
-  RESET = RESET_HIGH;
-  Delay1ms(500);
+  InitPhase = IP_RESET_HIGH;            // the reset pulse is the first step
 
   // initialize SSI0
   GPIO_PORTA_AFSEL_R |= 0x2C;           // enable alt funct on PA2,3,5
@@ -742,7 +1399,8 @@ void static commonInit(const uint8_t *cmdList) {
                                         // clock divider for 8 MHz SSIClk (80 MHz PLL/24)
                                         // SysClk/(CPSDVSR*(1+SCR))
                                         // 80/(10*(1+0)) = 8 MHz (slower than 4 MHz)
-  SSI0_CPSR_R = (SSI0_CPSR_R&~SSI_CPSR_CPSDVSR_M)+10; // must be even number
+                                        // see ILI9341_SetSpeed() for faster clocks
+  SSI0_CPSR_R = (SSI0_CPSR_R&~SSI_CPSR_CPSDVSR_M)+SpeedCpsr[ILI9341_SPEED_SAFE]; // must be even number
   SSI0_CR0_R &= ~(SSI_CR0_SCR_M |       // SCR = 0 (8 Mbps data rate)
                   SSI_CR0_SPH |         // SPH = 0
                   SSI_CR0_SPO);         // SPO = 0
@@ -750,9 +1408,16 @@ void static commonInit(const uint8_t *cmdList) {
   SSI0_CR0_R = (SSI0_CR0_R&~SSI_CR0_FRF_M)+SSI_CR0_FRF_MOTO;
                                         // DSS = 8-bit data
   SSI0_CR0_R = (SSI0_CR0_R&~SSI_CR0_DSS_M)+SSI_CR0_DSS_8;
+#if ILI9341_USE_UDMA
+  SSI0_CR1_R |= SSI_CR1_EOT;            // transmit interrupt at end of transmission
+#endif
   SSI0_CR1_R |= SSI_CR1_SSE;            // enable SSI
+#if ILI9341_USE_UDMA
+  dmaInit();
+#endif
 
-  if(cmdList) commandList(cmdList);
+  InitLists = 0;
+  if(cmdList) InitList[InitLists++] = cmdList;
 }
 
 
@@ -762,32 +1427,40 @@ void static commonInit(const uint8_t *cmdList) {
 // Output: none
 void ILI9341_InitB(void) {
   commonInit(Bcmd);
+  initRun();
   ILI9341_SetCursor(0,0);
   StTextColor = ILI9341_YELLOW;
   ILI9341_FillScreen(0);                 // set screen to black
 }
 
 
-//------------ILI9341_InitR------------
-// Initialization for ILI9341R screens (green or red tabs).
-// Input: option one of the enumerated options depending on tabs
-// Output: none
-void ILI9341_InitR(enum initRFlags option) {
+// Queue the command tables of an 'R' type display
+void static initListR(enum initRFlags option) {
   commonInit(Rcmd1);
   if(option == INITR_GREENTAB) {
-    commandList(Rcmd2green);
+    InitList[InitLists++] = Rcmd2green;
+  } else {
+    InitList[InitLists++] = Rcmd2red;
+  }
+  InitList[InitLists++] = Rcmd3;
+}
+
+// Finish an 'R' type display once its command tables have run
+void static initFinishR(enum initRFlags option) {
+  if(option == INITR_GREENTAB) {
     ColStart = 2;
     RowStart = 1;
-  } else {
-    // colstart, rowstart left at default '0' values
-    commandList(Rcmd2red);
   }
-  commandList(Rcmd3);
+  // colstart, rowstart left at default '0' values otherwise
 
   // if black, change MADCTL color filter
+  // The panel's color filter is BGR, so setting MADCTL_BGR makes
+  // standard RGB565 (red in the top bits) display correctly.
+  // The panel also takes its orientation from MADCTL, so callers
+  // draw top to bottom with no coordinate remapping.
   if (option == INITR_BLACKTAB) {
-    writecommand(ILI9341_MADCTL);
-    writedata(0xC0);
+    ColorOrder = MADCTL_BGR;
+    ILI9341_SetOrientation(ILI9341_DEFAULT_ROTATION, ILI9341_DEFAULT_MIRROR);
   }
   TabColor = option;
   ILI9341_SetCursor(0,0);
@@ -796,6 +1469,68 @@ void ILI9341_InitR(enum initRFlags option) {
 }
 
 
+//------------ILI9341_InitR------------
+// Initialization for ILI9341R screens (green or red tabs).
+// Input: option one of the enumerated options depending on tabs
+// Output: none
+void ILI9341_InitR(enum initRFlags option) {
+  initListR(option);
+  initRun();
+  initFinishR(option);
+}
+
+
+//------------ILI9341_InitR_Start------------
+// Start the initialization of ILI9341R screens in the background.
+// The reset pulse and the command tables, with their delays of
+// up to 500 ms, are run from Timer3A one-shot interrupts, so the
+// caller can initialize other devices meanwhile.  No other
+// ILI9341 function may be called until ILI9341_InitR_Wait().
+// Input: option one of the enumerated options depending on tabs
+// Output: none
+// Uses Timer3A at priority 5.  Interrupts must be enabled before
+// ILI9341_InitR_Wait() for the sequence to finish.
+void ILI9341_InitR_Start(enum initRFlags option) {
+  initListR(option);
+  InitOption = option;
+  SYSCTL_RCGCTIMER_R |= 0x08;           // activate TIMER3
+  (void)SYSCTL_RCGCTIMER_R;             // allow time for clock to start
+  TIMER3_CTL_R = 0x00000000;            // disable TIMER3A during setup
+  TIMER3_CFG_R = 0x00000000;            // configure for 32-bit mode
+  TIMER3_TAMR_R = 0x00000001;           // configure for one-shot mode, down-count
+  TIMER3_TAPR_R = 0;                    // bus clock resolution
+  TIMER3_IMR_R = 0x00000001;            // arm timeout interrupt
+  NVIC_PRI8_R = (NVIC_PRI8_R&0x00FFFFFF)|0xA0000000; // priority 5
+// vector number 51, interrupt number 35
+  NVIC_EN1_R = 1<<(35-32);              // enable IRQ 35 in NVIC
+  InitRunning = 1;
+  initTimer(initStep());                // the first step is a delay
+}
+
+
+//------------ILI9341_InitR_Done------------
+// Check whether the sequence started by ILI9341_InitR_Start()
+// has finished sending its command tables.
+// Input: none
+// Output: nonzero once ILI9341_InitR_Wait() will not wait
+int ILI9341_InitR_Done(void) {
+  return InitRunning == 0;
+}
+
+
+//------------ILI9341_InitR_Wait------------
+// Wait for the sequence started by ILI9341_InitR_Start(), then
+// set the orientation and clear the screen as ILI9341_InitR()
+// does.  The screen is ready to draw on when it returns.
+// Input: none
+// Output: none
+void ILI9341_InitR_Wait(void) {
+  while(InitRunning){};
+  TIMER3_IMR_R = 0x00000000;            // disarm TIMER3A
+  initFinishR(InitOption);
+}
+
+
 // Set the region of the screen RAM to be modified
 // Pixel colors are sent left to right, top to bottom
 // (same as Font table is encoded; different from regular bitmap)
@@ -823,14 +1558,295 @@ void static setAddrWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1) {
 	writedata(yEnd&0xFF);     // YEND
 
   writecommand(ILI9341_RAMWR); // write to RAM
+  STAT_ADD(windows, 1);
+  DC = DC_DATA;                 // everything up to the next command is pixels
+  if(PixelMode == ILI9341_PIXELS_16BIT){
+    setFrameBits(16);
+  }
 }
 
 
 // Send two bytes of data, most significant byte first
 // Requires 2 bytes of transmission
 void static pushColor(uint16_t color) {
-  writedata((uint8_t)(color >> 8));
-  writedata((uint8_t)color);
+  writepixel(color);
+}
+
+
+//------------ILI9341_SetWindow------------
+// Open an address window and leave the LCD in RAM write mode.
+// The following ILI9341_PushColor() calls fill the window left
+// to right, top to bottom, so a whole block costs one window.
+// Requires 11 bytes of transmission
+// Input: x0 horizontal position of the left edge, columns from the left edge
+//        y0 vertical position of the top edge, rows from the top edge
+//        x1 horizontal position of the right edge (inclusive)
+//        y1 vertical position of the bottom edge (inclusive)
+// Output: none
+// The window is not clipped; it must lie on the screen.
+void ILI9341_SetWindow(int16_t x0, int16_t y0, int16_t x1, int16_t y1) {
+  setAddrWindow(x0, y0, x1, y1);
+}
+
+
+//------------ILI9341_PushColor------------
+// Send one pixel into the window opened by ILI9341_SetWindow().
+// Requires 2 bytes of transmission
+// Input: color 16-bit color, which can be produced by ILI9341_Color565()
+// Output: none
+void ILI9341_PushColor(uint16_t color) {
+  pushColor(color);
+}
+
+
+#if ILI9341_TILES
+// Tile compositor.  Between ILI9341_BatchBegin() and
+// ILI9341_BatchEnd() the drawing functions only record what they
+// would draw.  ILI9341_BatchEnd() then cuts the region into bands
+// of full-width rows that fit in Tile[], paints the background
+// and every recorded primitive, in order, into each band, and
+// sends the band through one address window, so nothing is drawn
+// twice on the glass.
+enum batchOpType{
+  BOP_FILL,                     // rectangle x,y,w,h
+  BOP_LINE,                     // line from x,y to w,h
+  BOP_CHAR,                     // character c with its top left corner at x,y
+  BOP_BITMAP                    // ILI9341_DrawBitmap() image, bottom left corner at x,y
+};
+typedef struct{
+  uint8_t type;                 // enum batchOpType
+  uint8_t size;                 // BOP_CHAR pixels per font pixel
+  uint8_t opaque;               // BOP_CHAR nonzero to paint the background
+  char c;                       // BOP_CHAR character
+  int16_t x, y, w, h;
+  uint16_t color, bg;
+  const uint16_t *image;        // BOP_BITMAP pixels
+} batchOp_t;
+static batchOp_t BatchOps[ILI9341_BATCH_OPS];
+static uint16_t Tile[ILI9341_TILE_PIXELS];
+static uint8_t BatchCount;              // primitives recorded
+static uint8_t Batching;                // nonzero between ILI9341_BatchBegin() and ILI9341_BatchEnd()
+static int16_t BatchX, BatchY, BatchW, BatchH;  // region, clipped to the screen
+static uint16_t BatchBg;                // region background
+static int16_t TileY0, TileY1;          // screen rows in Tile[]
+
+uint8_t static glyphRow(char c, int32_t row);
+
+// Color one pixel of the band, if it is in it
+void static tilePut(int32_t x, int32_t y, uint16_t color){
+  if((x >= BatchX) && (x < BatchX+BatchW) && (y >= TileY0) && (y <= TileY1)){
+    Tile[(y-TileY0)*BatchW + (x-BatchX)] = color;
+  }
+}
+
+// Paint one recorded primitive into the band
+void static tileOp(const batchOp_t *op){
+  int32_t x0, y0, x1, y1, px, py, dx, dy, sx, sy, err, e2, row;
+  uint16_t *pt;
+  uint8_t mask;
+  if(op->type == BOP_LINE){              // Bresenham, keeping the points in the band
+    x0 = op->x; y0 = op->y; x1 = op->w; y1 = op->h;
+    dx = (x1 > x0) ? x1-x0 : x0-x1;  sx = (x0 < x1) ? 1 : -1;
+    dy = (y1 > y0) ? y0-y1 : y1-y0;  sy = (y0 < y1) ? 1 : -1;
+    err = dx + dy;
+    while(1){
+      tilePut(x0, y0, op->color);
+      if((x0 == x1) && (y0 == y1)) return;
+      e2 = 2*err;
+      if(e2 >= dy){ err = err + dy; x0 = x0 + sx; }
+      if(e2 <= dx){ err = err + dx; y0 = y0 + sy; }
+    }
+  }
+  x0 = op->x;                            // bounding box of the primitive
+  y0 = op->y;
+  if(op->type == BOP_CHAR){
+    x1 = x0 + 6*op->size - 1;
+    y1 = y0 + 8*op->size - 1;
+  } else if(op->type == BOP_BITMAP){
+    x1 = x0 + op->w - 1;
+    y1 = y0;
+    y0 = y0 - op->h + 1;
+  } else{
+    x1 = x0 + op->w - 1;
+    y1 = y0 + op->h - 1;
+  }
+  if(x0 < BatchX) x0 = BatchX;           // clip to the band
+  if(x1 >= BatchX+BatchW) x1 = BatchX+BatchW-1;
+  if(y0 < TileY0) y0 = TileY0;
+  if(y1 > TileY1) y1 = TileY1;
+  for(py=y0; py<=y1; py=py+1){
+    pt = &Tile[(py-TileY0)*BatchW + (x0-BatchX)];
+    if(op->type == BOP_FILL){
+      for(px=x0; px<=x1; px=px+1) *pt++ = op->color;
+    } else if(op->type == BOP_CHAR){
+      row = (py-op->y)/op->size;
+      if(op->opaque == 0){              // ILI9341_DrawCharS() draws these bottom row first
+        row = 7 - row;
+      }
+      mask = glyphRow(op->c, row);
+      for(px=x0; px<=x1; px=px+1){
+        if((mask>>((px-op->x)/op->size))&0x01){
+          *pt = op->color;
+        } else if(op->opaque){
+          *pt = op->bg;
+        }
+        pt++;
+      }
+    } else{                              // BOP_BITMAP, bottom row first in ROM
+      const uint16_t *src = &op->image[(op->y-py)*op->w + (x0-op->x)];
+      for(px=x0; px<=x1; px=px+1) *pt++ = *src++;
+    }
+  }
+}
+
+// Paint and send every band of the region
+void static batchFlush(void){
+  int32_t rows, i, n;
+  rows = ILI9341_TILE_PIXELS/BatchW;
+  for(TileY0=BatchY; TileY0<BatchY+BatchH; TileY0=TileY0+rows){
+    TileY1 = TileY0 + rows - 1;
+    if(TileY1 >= BatchY+BatchH) TileY1 = BatchY+BatchH-1;
+    n = (TileY1-TileY0+1)*BatchW;
+    ILI9341_Async_Wait();                // the last band may still be leaving Tile[]
+    for(i=0; i<n; i=i+1) Tile[i] = BatchBg;
+    for(i=0; i<BatchCount; i=i+1) tileOp(&BatchOps[i]);
+    setAddrWindow(BatchX, TileY0, BatchX+BatchW-1, TileY1);
+    if(FrameBits == 16){
+      ILI9341_DMA_WritePixels(Tile, n, 0);
+    } else{
+      for(i=0; i<n; i=i+1) writepixel(Tile[i]);
+    }
+  }
+  ILI9341_Async_Wait();
+}
+
+// Record a primitive; when the list is full the region is sent
+// now and the rest of the batch is drawn directly
+batchOp_t static *batchAdd(uint8_t type){
+  if(BatchCount == ILI9341_BATCH_OPS){
+    Batching = 0;
+    batchFlush();
+    return 0;
+  }
+  BatchOps[BatchCount].type = type;
+  return &BatchOps[BatchCount++];
+}
+
+// Record a rectangle; 0 if it must be drawn directly instead
+int static batchFill(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color){
+  batchOp_t *op = batchAdd(BOP_FILL);
+  if(op == 0) return 0;
+  op->x = x; op->y = y; op->w = w; op->h = h;
+  op->color = color;
+  return 1;
+}
+
+// Record a character; 0 if it must be drawn directly instead
+int static batchChar(int16_t x, int16_t y, char c, uint16_t textColor, uint16_t bgColor, uint8_t size, uint8_t opaque){
+  batchOp_t *op = batchAdd(BOP_CHAR);
+  if(op == 0) return 0;
+  op->x = x; op->y = y;
+  op->c = c;
+  op->color = textColor;
+  op->bg = bgColor;
+  op->size = size;
+  op->opaque = opaque;
+  return 1;
+}
+#endif
+
+
+//------------ILI9341_BatchBegin------------
+// Start drawing into a region off the glass.  Until
+// ILI9341_BatchEnd(), ILI9341_FillRect(), ILI9341_FillScreen(),
+// ILI9341_DrawPixel(), ILI9341_DrawFastVLine(),
+// ILI9341_DrawFastHLine(), ILI9341_Line(), ILI9341_DrawCharS(),
+// ILI9341_DrawChar(), ILI9341_DrawString() and
+// ILI9341_DrawBitmap() are recorded (up to ILI9341_BATCH_OPS of
+// them) and painted into a RAM tile when the batch ends.  Other
+// drawing functions go straight to the glass and are covered by
+// the region when the batch ends.
+// Input: x       horizontal position of the top left corner of the region, columns from the left edge
+//        y       vertical position of the top left corner of the region, rows from the top edge
+//        w       width of the region
+//        h       height of the region
+//        bgColor color of the region where nothing is drawn
+// Output: none
+// If ILI9341_TILES is 0 the region is cleared and the drawing
+// functions draw directly.
+void ILI9341_BatchBegin(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t bgColor){
+#if ILI9341_TILES
+  if(x < 0){ w = w + x; x = 0; }
+  if(y < 0){ h = h + y; y = 0; }
+  if((x + w) > _width) w = _width - x;
+  if((y + h) > _height) h = _height - y;
+  if((w <= 0) || (h <= 0)) return;
+  BatchX = x; BatchY = y; BatchW = w; BatchH = h;
+  BatchBg = bgColor;
+  BatchCount = 0;
+  Batching = 1;
+#else
+  ILI9341_FillRect(x, y, w, h, bgColor);
+#endif
+}
+
+
+//------------ILI9341_BatchEnd------------
+// Paint the primitives recorded since ILI9341_BatchBegin() and
+// send the region, a band of rows at a time, each through one
+// address window.
+// Requires (11*bands + 2*w*h) bytes of transmission
+// Input: none
+// Output: none
+void ILI9341_BatchEnd(void){
+#if ILI9341_TILES
+  if(Batching){
+    Batching = 0;
+    batchFlush();
+  }
+#endif
+}
+
+
+//------------ILI9341_Line------------
+// Draw a line of one pixel width between two points.
+// Requires 13 bytes of transmission per pixel
+// Input: x1,y1 one end of the line
+//        x2,y2 other end of the line
+//        color 16-bit color, which can be produced by ILI9341_Color565()
+// Output: none
+void ILI9341_Line(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t color){
+  int32_t dx, dy, sx, sy, err, e2;
+#if ILI9341_TILES
+  if(Batching){
+    batchOp_t *op = batchAdd(BOP_LINE);
+    if(op){
+      op->x = x1; op->y = y1; op->w = x2; op->h = y2;
+      op->color = color;
+      return;
+    }
+  }
+#endif
+  if(x1 == x2){                          // vertical, one window
+    if(y1 > y2){ dy = y1; y1 = y2; y2 = dy; }
+    ILI9341_DrawFastVLine(x1, y1, y2-y1+1, color);
+    return;
+  }
+  if(y1 == y2){                          // horizontal, one window
+    if(x1 > x2){ dx = x1; x1 = x2; x2 = dx; }
+    ILI9341_DrawFastHLine(x1, y1, x2-x1+1, color);
+    return;
+  }
+  dx = (x2 > x1) ? x2-x1 : x1-x2;  sx = (x1 < x2) ? 1 : -1;
+  dy = (y2 > y1) ? y1-y2 : y2-y1;  sy = (y1 < y2) ? 1 : -1;
+  err = dx + dy;
+  while(1){
+    ILI9341_DrawPixel(x1, y1, color);
+    if((x1 == x2) && (y1 == y2)) return;
+    e2 = 2*err;
+    if(e2 >= dy){ err = err + dy; x1 = x1 + sx; }
+    if(e2 <= dx){ err = err + dx; y1 = y1 + sy; }
+  }
 }
 
 
@@ -846,6 +1862,9 @@ void static pushColor(uint16_t color) {
 //        color 16-bit color, which can be produced by ILI9341_Color565()
 // Output: none
 void ILI9341_DrawPixel(int16_t x, int16_t y, uint16_t color) {
+#if ILI9341_TILES
+  if(Batching && batchFill(x, y, 1, 1, color)) return;
+#endif
 
   if((x < 0) || (x >= _width) || (y < 0) || (y >= _height)) return;
 
@@ -866,7 +1885,9 @@ void ILI9341_DrawPixel(int16_t x, int16_t y, uint16_t color) {
 //        color 16-bit color, which can be produced by ILI9341_Color565()
 // Output: none
 void ILI9341_DrawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
-  uint8_t hi = color >> 8, lo = color;
+#if ILI9341_TILES
+  if(Batching && batchFill(x, y, 1, h, color)) return;
+#endif
 
   // Rudimentary clipping
   if((x >= _width) || (y >= _height)) return;
@@ -874,8 +1895,7 @@ void ILI9341_DrawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
   setAddrWindow(x, y, x, y+h-1);
 
   while (h--) {
-    writedata(hi);
-    writedata(lo);
+    writepixel(color);
   }
 }
 
@@ -890,7 +1910,9 @@ void ILI9341_DrawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
 //        color 16-bit color, which can be produced by ILI9341_Color565()
 // Output: none
 void ILI9341_DrawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
-  uint8_t hi = color >> 8, lo = color;
+#if ILI9341_TILES
+  if(Batching && batchFill(x, y, w, 1, color)) return;
+#endif
 
   // Rudimentary clipping
   if((x >= _width) || (y >= _height)) return;
@@ -898,8 +1920,7 @@ void ILI9341_DrawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
   setAddrWindow(x, y, x+w-1, y);
 
   while (w--) {
-    writedata(hi);
-    writedata(lo);
+    writepixel(color);
   }
 }
 
@@ -925,19 +1946,34 @@ void ILI9341_FillScreen(uint16_t color) {
 //        color 16-bit color, which can be produced by ILI9341_Color565()
 // Output: none
 void ILI9341_FillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
-  uint8_t hi = color >> 8, lo = color;
+#if ILI9341_TILES
+  if(Batching && batchFill(x, y, w, h, color)) return;
+#endif
 
   // rudimentary clipping (drawChar w/big text requires this)
   if((x >= _width) || (y >= _height)) return;
   if((x + w - 1) >= _width)  w = _width  - x;
   if((y + h - 1) >= _height) h = _height - y;
 
+#if ILI9341_USE_UDMA
+  if(Async){
+    dispOp_t op;
+    if((w <= 0) || (h <= 0)) return;
+    op.type = OP_FILL;
+    op.item = 2;                        // 16-bit frames
+    opWindow(&op, x, y, x+w-1, y+h-1);
+    op.color = color;
+    op.count = (uint32_t)w*h;
+    op.done = 0;
+    opQueue(&op);
+    return;
+  }
+#endif
   setAddrWindow(x, y, x+w-1, y+h-1);
 
   for(y=h; y>0; y--) {
     for(x=w; x>0; x--) {
-      writedata(hi);
-      writedata(lo);
+      writepixel(color);
     }
   }
 }
@@ -950,17 +1986,19 @@ void ILI9341_FillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color
 //        b blue value
 // Output: 16-bit color
 uint16_t ILI9341_Color565(uint8_t r, uint8_t g, uint8_t b) {
-  return ((b & 0xF8) << 8) | ((g & 0xFC) << 3) | (r >> 3);
+  return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
 }
 
 //------------vGL2ILI_Color------------
 // Pass R (5-bit) ,G (6-bit) ,B (5-bit) and get back 16-bit packed color. (for interface with LittlevGL)
+// This is the same layout as lv_color_t.full, so LittlevGL buffers
+// need no conversion.
 // Input: r red value
 //        g green value
 //        b blue value
 // Output: 16-bit color
 uint16_t vGL2ILI_Color(uint8_t red, uint8_t green, uint8_t blue) {
-	return ((blue & 0x1F) << 11) | ((green & 0x3F) << 5) | (red & 0x1F);
+	return ((red & 0x1F) << 11) | ((green & 0x3F) << 5) | (blue & 0x1F);
 }
 
 
@@ -997,6 +2035,16 @@ void ILI9341_DrawBitmap(int16_t x, int16_t y, const uint16_t *image, int16_t w,
   int16_t skipC = 0;                      // non-zero if columns need to be skipped due to clipping
   int16_t originalWidth = w;              // save this value; even if not all columns fit on the screen, the image is still this width in ROM
   int i = w*(h - 1);
+#if ILI9341_TILES
+  if(Batching){
+    batchOp_t *op = batchAdd(BOP_BITMAP);
+    if(op){
+      op->x = x; op->y = y; op->w = w; op->h = h;
+      op->image = image;
+      return;
+    }
+  }
+#endif
 
   if((x >= _width) || ((y - h + 1) >= _height) || ((x + w) <= 0) || (y < 0)){
     return;                             // image is totally off the screen, do nothing
@@ -1027,14 +2075,27 @@ void ILI9341_DrawBitmap(int16_t x, int16_t y, const uint16_t *image, int16_t w,
     y = _height - 1;
   }
 
+#if ILI9341_USE_UDMA
+  if(Async){
+    dispOp_t op;
+    if((w <= 0) || (h <= 0)) return;
+    op.type = OP_BITMAP;
+    op.item = 2;                        // 16-bit frames
+    opWindow(&op, x, y-h+1, x+w-1, y);
+    op.src = &image[i];                 // top row is last in the array
+    op.count = w;
+    op.rows = h;
+    op.stride = -originalWidth;
+    op.done = 0;
+    opQueue(&op);
+    return;
+  }
+#endif
   setAddrWindow(x, y-h+1, x+w-1, y);
 
   for(y=0; y<h; y=y+1){
     for(x=0; x<w; x=x+1){
-                                        // send the top 8 bits
-      writedata((uint8_t)(image[i] >> 8));
-                                        // send the bottom 8 bits
-      writedata((uint8_t)image[i]);
+      writepixel(image[i]);             // top 8 bits first
       i = i + 1;                        // go to the next pixel
     }
     i = i + skipC;
@@ -1043,14 +2104,213 @@ void ILI9341_DrawBitmap(int16_t x, int16_t y, const uint16_t *image, int16_t w,
 }
 
 
+
+// Window for the top-down bitmap decoders.  (x,y) is the top left
+// corner of a w by h image; the part that is on the screen becomes
+// the address window, and Clip* hold the image rows and columns
+// that land in it.  Returns 0 if nothing is visible.
+static int16_t ClipCol0, ClipCol1, ClipRow0, ClipRow1;
+int static bitmapWindow(int16_t x, int16_t y, int16_t w, int16_t h){
+  int16_t x0 = x, y0 = y;
+  int16_t x1 = x + w - 1, y1 = y + h - 1;
+  if(x0 < 0) x0 = 0;
+  if(y0 < 0) y0 = 0;
+  if(x1 >= _width) x1 = _width - 1;
+  if(y1 >= _height) y1 = _height - 1;
+  if((x0 > x1) || (y0 > y1)){
+    return 0;                           // image is totally off the screen
+  }
+  ClipCol0 = x0 - x; ClipCol1 = x1 - x;
+  ClipRow0 = y0 - y; ClipRow1 = y1 - y;
+  setAddrWindow(x0, y0, x1, y1);
+  return 1;
+}
+
+
+//------------ILI9341_DrawBitmapRLE------------
+// Displays a run-length encoded 16-bit color image, decoding it
+// straight into the SSI stream.  The image is stored top row
+// first, left to right, as packets of halfwords; a packet may
+// continue onto the next row.
+//   0nnnnnnn nnnnnnnn, c         n copies of color c
+//   1nnnnnnn nnnnnnnn, c1 ... cn n colors sent as they are
+// Bitmaps/lvimg2ili.py makes these arrays.  Parts of the image
+// off the screen are decoded and dropped.
+// Requires (11 + 2*w*h) bytes of transmission (assuming image fully on screen)
+// Input: x     horizontal position of the top left corner of the image, columns from the left edge
+//        y     vertical position of the top left corner of the image, rows from the top edge
+//        rle   pointer to the packets
+//        w     number of pixels wide
+//        h     number of pixels tall
+// Output: none
+void ILI9341_DrawBitmapRLE(int16_t x, int16_t y, const uint16_t *rle, int16_t w, int16_t h){
+  int16_t row = 0, col = 0;
+  uint16_t n, color;
+  int literal;
+  if(bitmapWindow(x, y, w, h) == 0) return;
+  while(row <= ClipRow1){
+    n = *rle++;
+    literal = n&0x8000;
+    n = n&0x7FFF;
+    color = *rle;
+    while(n){
+      if(literal){
+        color = *rle++;
+      }
+      if((row >= ClipRow0) && (col >= ClipCol0) && (col <= ClipCol1)){
+        writepixel(color);
+      }
+      col = col + 1;
+      if(col == w){                     // packets run on into the next row
+        col = 0;
+        row = row + 1;
+      }
+      n = n - 1;
+    }
+    if(literal == 0){
+      rle = rle + 1;                    // skip the run color
+    }
+  }
+}
+
+
+//------------ILI9341_DrawBitmapPal8------------
+// Displays an image of 8-bit indices into a palette of up to 256
+// 16-bit colors, top row first, left to right, one byte per
+// pixel.  Each index is looked up as it is sent.
+// Bitmaps/lvimg2ili.py makes these arrays.
+// Requires (11 + 2*w*h) bytes of transmission (assuming image fully on screen)
+// Input: x       horizontal position of the top left corner of the image, columns from the left edge
+//        y       vertical position of the top left corner of the image, rows from the top edge
+//        palette pointer to the 16-bit colors
+//        index   pointer to the w*h indices
+//        w       number of pixels wide
+//        h       number of pixels tall
+// Output: none
+void ILI9341_DrawBitmapPal8(int16_t x, int16_t y, const uint16_t *palette, const uint8_t *index, int16_t w, int16_t h){
+  int16_t row, col;
+  const uint8_t *pt;
+  if(bitmapWindow(x, y, w, h) == 0) return;
+  for(row=ClipRow0; row<=ClipRow1; row=row+1){
+    pt = &index[row*w + ClipCol0];
+    for(col=ClipCol0; col<=ClipCol1; col=col+1){
+      writepixel(palette[*pt++]);
+    }
+  }
+}
+
+
+//------------ILI9341_DrawBitmapPal4------------
+// Displays an image of 4-bit indices into a palette of up to 16
+// 16-bit colors, top row first, left to right, two pixels per
+// byte with the left pixel in the high nibble.  Every row starts
+// on a new byte, so a row takes (w+1)/2 bytes.
+// Bitmaps/lvimg2ili.py makes these arrays.
+// Requires (11 + 2*w*h) bytes of transmission (assuming image fully on screen)
+// Input: x       horizontal position of the top left corner of the image, columns from the left edge
+//        y       vertical position of the top left corner of the image, rows from the top edge
+//        palette pointer to the 16-bit colors
+//        index   pointer to the h*((w+1)/2) bytes of indices
+//        w       number of pixels wide
+//        h       number of pixels tall
+// Output: none
+void ILI9341_DrawBitmapPal4(int16_t x, int16_t y, const uint16_t *palette, const uint8_t *index, int16_t w, int16_t h){
+  int16_t row, col;
+  const uint8_t *pt;
+  if(bitmapWindow(x, y, w, h) == 0) return;
+  for(row=ClipRow0; row<=ClipRow1; row=row+1){
+    pt = &index[row*((w + 1)/2)];
+    for(col=ClipCol0; col<=ClipCol1; col=col+1){
+      if(col&1){
+        writepixel(palette[pt[col/2]&0x0F]);
+      } else{
+        writepixel(palette[pt[col/2]>>4]);
+      }
+    }
+  }
+}
+
+// Glyph cache.  The font stores each character as 5 columns of 8
+// bits, but the LCD is written a row at a time, so every glyph
+// drawn is first turned into 8 row masks (bit 0 is the left
+// column, bit 5 the blank column).  The last GLYPH_CACHE_SIZE
+// characters are kept, direct mapped by character code.
+#define GLYPH_CACHE_SIZE 16     // must be a power of 2
+static struct{
+  uint8_t valid;
+  char c;
+  uint8_t rows[8];
+} GlyphCache[GLYPH_CACHE_SIZE];
+
+// Return row (0 is the top) of character c as a mask of columns
+uint8_t static glyphRow(char c, int32_t row){
+  uint32_t slot = ((uint8_t)c)&(GLYPH_CACHE_SIZE-1);
+  int32_t col, r;
+  if((GlyphCache[slot].valid == 0) || (GlyphCache[slot].c != c)){
+    for(r=0; r<8; r=r+1){
+      GlyphCache[slot].rows[r] = 0;
+      for(col=0; col<5; col=col+1){
+        if(Font[(((uint8_t)c)*5)+col]&(1<<r)){
+          GlyphCache[slot].rows[r] |= 1<<col;
+        }
+      }
+    }
+    GlyphCache[slot].c = c;
+    GlyphCache[slot].valid = 1;
+  }
+  return GlyphCache[slot].rows[row];
+}
+
+// Draw n characters side by side with one address window, the
+// whole text line is streamed a row at a time.  Nothing is clipped.
+// Requires (11 + 2*size*size*6*8*n) bytes of transmission
+void static drawGlyphRun(int16_t x, int16_t y, const char *pt, int32_t n,
+                         uint16_t textColor, uint16_t bgColor, uint8_t size){
+  int32_t row, col, i, j, k;
+  uint8_t mask;
+  uint16_t color;
+
+#if ILI9341_TILES
+  if(Batching){
+    for(k=0; k<n; k=k+1){
+      if(batchChar(x+6*size*k, y, pt[k], textColor, bgColor, size, 1) == 0){
+        break;                          // list full
+      }
+    }
+    if(k == n) return;                  // all recorded
+    pt = pt + k;                        // draw the rest directly
+    x = x + 6*size*k;
+    n = n - k;
+  }
+#endif
+  setAddrWindow(x, y, x+6*size*n-1, y+8*size-1);
+
+  for(row=0; row<8; row=row+1){         // print the rows, starting at the top
+    for(i=0; i<size; i=i+1){
+      for(k=0; k<n; k=k+1){
+        mask = glyphRow(pt[k], row);
+        for(col=0; col<6; col=col+1){   // 5 font columns and a blank one
+          color = (mask&0x01) ? textColor : bgColor;
+          for(j=0; j<size; j=j+1){
+            writepixel(color);
+          }
+          mask = mask>>1;
+        }
+      }
+    }
+  }
+}
+
+
 //------------ILI9341_DrawCharS------------
 // Simple character draw function.  This is the same function from
-// Adafruit_GFX.c but adapted for this processor.  However, each call
-// to ILI9341_DrawPixel() calls setAddrWindow(), which needs to send
-// many extra data and commands.  If the background color is the same
-// as the text color, no background will be printed, and text can be
-// drawn right over existing images without covering them with a box.
-// Requires (11 + 2*size*size)*6*8 (image fully on screen; textcolor != bgColor)
+// Adafruit_GFX.c but adapted for this processor.  A character that
+// is fully on the screen is sent through one address window, with
+// the background.  If the background color is the same as the
+// text color, no background will be printed, and text can be
+// drawn right over existing images without covering them with a
+// box; then each lit pixel is drawn separately.
+// Requires (11 + 2*size*size*6*8) bytes of transmission (image fully on screen; textcolor != bgColor)
 // Input: x         horizontal position of the top left corner of the character, columns from the left edge
 //        y         vertical position of the top left corner of the character, rows from the top edge
 //        c         character to be printed
@@ -1061,12 +2321,21 @@ void ILI9341_DrawBitmap(int16_t x, int16_t y, const uint16_t *image, int16_t w,
 void ILI9341_DrawCharS(int16_t x, int16_t y, char c, int16_t textColor, int16_t bgColor, uint8_t size){
   uint8_t line; // vertical column of pixels of character in font
   int32_t i, j;
+#if ILI9341_TILES
+  if(Batching && batchChar(x, y, c, textColor, bgColor, size, bgColor != textColor)) return;
+#endif
   if((x >= _width)            || // Clip right
      (y >= _height)           || // Clip bottom
      ((x + 5 * size - 1) < 0) || // Clip left
      ((y + 8 * size - 1) < 0))   // Clip top
     return;
 
+  if((bgColor != textColor) && (x >= 0) && (y >= 0) &&
+     ((x + 6*size) <= _width) && ((y + 8*size) <= _height)){
+    drawGlyphRun(x, y, &c, 1, textColor, bgColor, size);
+    return;
+  }
+
   for (i=0; i<6; i++ ) {
     if (i == 5)
       line = 0x0;
@@ -1106,8 +2375,6 @@ void ILI9341_DrawCharS(int16_t x, int16_t y, char c, int16_t textColor, int16_t
 //        size      number of pixels per character pixel (e.g. size==2 prints each pixel of font as 2x2 square)
 // Output: none
 void ILI9341_DrawChar(int16_t x, int16_t y, char c, int16_t textColor, int16_t bgColor, uint8_t size){
-  uint8_t line; // horizontal row of pixels of character
-  int32_t col, row, i, j;// loop indices
   if(((x + 5*size - 1) >= _width)  || // Clip right
      ((y + 8*size - 1) >= _height) || // Clip bottom
      ((x + 5*size - 1) < 0)        || // Clip left
@@ -1115,38 +2382,14 @@ void ILI9341_DrawChar(int16_t x, int16_t y, char c, int16_t textColor, int16_t b
     return;
   }
 
-  setAddrWindow(x, y, x+6*size-1, y+8*size-1);
-
-  line = 0x01;        // print the top row first
-  // print the rows, starting at the top
-  for(row=0; row<8; row=row+1){
-    for(i=0; i<size; i=i+1){
-      // print the columns, starting on the left
-      for(col=0; col<5; col=col+1){
-        if(Font[(c*5)+col]&line){
-          // bit is set in Font, print pixel(s) in text color
-          for(j=0; j<size; j=j+1){
-            pushColor(textColor);
-          }
-        } else{
-          // bit is cleared in Font, print pixel(s) in background color
-          for(j=0; j<size; j=j+1){
-            pushColor(bgColor);
-          }
-        }
-      }
-      // print blank column(s) to the right of character
-      for(j=0; j<size; j=j+1){
-        pushColor(bgColor);
-      }
-    }
-    line = line<<1;   // move up to the next row
-  }
+  drawGlyphRun(x, y, &c, 1, textColor, bgColor, size);
 }
 //------------ILI9341_DrawString------------
 // String draw function.
 // 16 rows (0 to 15) and 21 characters (0 to 20)
-// Requires (11 + size*size*6*8) bytes of transmission for each character
+// The characters that fit on the line are sent through one
+// address window.
+// Requires (11 + 2*6*8*n) bytes of transmission for n characters
 // Input: x         columns from the left edge (0 to 20)
 //        y         rows from the top edge (0 to 15)
 //        pt        pointer to a null terminated string to be printed
@@ -1155,14 +2398,30 @@ void ILI9341_DrawChar(int16_t x, int16_t y, char c, int16_t textColor, int16_t b
 // Output: number of characters printed
 uint32_t ILI9341_DrawString(uint16_t x, uint16_t y, char *pt, int16_t textColor){
   uint32_t count = 0;
+  int32_t n = 0;
   if(y>15) return 0;
-  while(*pt){
+  if(textColor == ILI9341_BLACK){       // transparent text, one character at a time
+    while(*pt){
+      ILI9341_DrawCharS(x*6, y*10, *pt, textColor, ILI9341_BLACK, 1);
+      pt++;
+      x = x+1;
+      if(x>20) return count;  // number of characters printed
+      count++;
+    }
+    return count;  // number of characters printed
+  }
+  if((x > 20) && *pt){                  // one character past the end of the line
     ILI9341_DrawCharS(x*6, y*10, *pt, textColor, ILI9341_BLACK, 1);
-    pt++;
-    x = x+1;
-    if(x>20) return count;  // number of characters printed
-    count++;
+    return 0;
+  }
+  while(pt[n] && ((x+n) <= 20)){
+    n = n+1;
+  }
+  if(n){
+    drawGlyphRun(x*6, y*10, pt, n, textColor, ILI9341_BLACK, 1);
   }
+  count = n;
+  if((x+n) > 20) count = n-1;  // the character in column 20 is not counted
   return count;  // number of characters printed
 }
 
@@ -1221,61 +2480,146 @@ void ILI9341_OutUDec(uint32_t n){
 
 
 
-#define MADCTL_MY  0x80
-#define MADCTL_MX  0x40
-#define MADCTL_MV  0x20
-#define MADCTL_ML  0x10
-#define MADCTL_RGB 0x00
-#define MADCTL_BGR 0x08
-#define MADCTL_MH  0x04
-
-//------------ILI9341_SetRotation------------
-// Change the image rotation.
+//------------ILI9341_SetOrientation------------
+// Change the image rotation and mirroring.  The panel reorders
+// the pixels itself, so windows are always filled left to right,
+// top to bottom in the new orientation.
 // Requires 2 bytes of transmission
-// Input: m new rotation value (0 to 3)
+// Input: m      new rotation value (0 to 3)
+//        mirror ILI9341_MIRROR_X to flip left-right,
+//               ILI9341_MIRROR_Y to flip top-bottom, or both
 // Output: none
-void ILI9341_SetRotation(uint8_t m) {
+void ILI9341_SetOrientation(uint8_t m, uint8_t mirror) {
+  uint8_t madctl;
 
-  writecommand(ILI9341_MADCTL);
   Rotation = m % 4; // can't be higher than 3
+  Mirror = mirror;
   switch (Rotation) {
    case 0:
-     if (TabColor == INITR_BLACKTAB) {
-       writedata(MADCTL_MX | MADCTL_MY | MADCTL_RGB);
-     } else {
-       writedata(MADCTL_MX | MADCTL_MY | MADCTL_BGR);
-     }
-     _width  = ILI9341_TFTWIDTH;
-     _height = ILI9341_TFTHEIGHT;
+     madctl = MADCTL_MX | MADCTL_MY;
      break;
    case 1:
-     if (TabColor == INITR_BLACKTAB) {
-       writedata(MADCTL_MY | MADCTL_MV | MADCTL_RGB);
-     } else {
-       writedata(MADCTL_MY | MADCTL_MV | MADCTL_BGR);
-     }
-     _width  = ILI9341_TFTHEIGHT;
-     _height = ILI9341_TFTWIDTH;
+     madctl = MADCTL_MY | MADCTL_MV;
      break;
-  case 2:
-     if (TabColor == INITR_BLACKTAB) {
-       writedata(MADCTL_RGB);
-     } else {
-       writedata(MADCTL_BGR);
-     }
-     _width  = ILI9341_TFTWIDTH;
-     _height = ILI9341_TFTHEIGHT;
-    break;
-   case 3:
-     if (TabColor == INITR_BLACKTAB) {
-       writedata(MADCTL_MX | MADCTL_MV | MADCTL_RGB);
-     } else {
-       writedata(MADCTL_MX | MADCTL_MV | MADCTL_BGR);
-     }
-     _width  = ILI9341_TFTHEIGHT;
-     _height = ILI9341_TFTWIDTH;
+   case 2:
+     madctl = 0;
      break;
+   default:
+     madctl = MADCTL_MX | MADCTL_MV;
+     break;
+  }
+  if (madctl & MADCTL_MV) {
+    // rows and columns are exchanged, so screen x is the panel's row order
+    if (mirror & ILI9341_MIRROR_X) madctl ^= MADCTL_MY;
+    if (mirror & ILI9341_MIRROR_Y) madctl ^= MADCTL_MX;
+    _width  = ILI9341_TFTHEIGHT;
+    _height = ILI9341_TFTWIDTH;
+  } else {
+    if (mirror & ILI9341_MIRROR_X) madctl ^= MADCTL_MX;
+    if (mirror & ILI9341_MIRROR_Y) madctl ^= MADCTL_MY;
+    _width  = ILI9341_TFTWIDTH;
+    _height = ILI9341_TFTHEIGHT;
+  }
+  Madctl = madctl;
+  ScrollHeight = 0;                     // the scrolling area is in panel rows
+  writecommand(ILI9341_MADCTL);
+  writedata(madctl | ColorOrder);
+}
+
+
+//------------ILI9341_SetRotation------------
+// Change the image rotation, keeping the mirroring set by
+// ILI9341_SetOrientation().
+// Requires 2 bytes of transmission
+// Input: m new rotation value (0 to 3)
+// Output: none
+void ILI9341_SetRotation(uint8_t m) {
+  ILI9341_SetOrientation(m, Mirror);
+}
+
+
+//------------ILI9341_SetScrollRegion------------
+// Define the rows that scroll with ILI9341_Scroll().  The rows
+// above and below stay fixed.  The scrolling area runs across
+// the whole width of the panel.  Scrolling starts at offset 0.
+// Requires 9 bytes of transmission
+// Input: top    first row of the scrolling area
+//        bottom last row of the scrolling area
+// Output: 1 if successful, 0 if the orientation does not allow it
+// Hardware scrolling moves panel rows, so it only works when
+// screen rows are panel rows (rotation 0 or 2, not mirrored
+// top-bottom relative to the panel, as ILI9341_DEFAULT_MIRROR
+// gives).  Call ILI9341_SetScrollRegion(0, 319) to go back to an
+// unscrolled screen.
+int ILI9341_SetScrollRegion(uint16_t top, uint16_t bottom){
+  uint16_t bfa;
+  if((Madctl&(MADCTL_MV|MADCTL_MY)) || (top > bottom) || (bottom >= ILI9341_TFTHEIGHT)){
+    return 0;
   }
+  bfa = ILI9341_TFTHEIGHT - 1 - bottom;
+  ScrollTop = top;
+  ScrollHeight = bottom - top + 1;
+  ScrollOffset = 0;
+  writecommand(ILI9341_VSCRDEF);
+  writedata(top>>8);
+  writedata(top&0xFF);                  // top fixed area
+  writedata(ScrollHeight>>8);
+  writedata(ScrollHeight&0xFF);         // vertical scrolling area
+  writedata(bfa>>8);
+  writedata(bfa&0xFF);                  // bottom fixed area
+  ILI9341_Scroll(0);
+  return 1;
+}
+
+
+//------------ILI9341_Scroll------------
+// Scroll the area set by ILI9341_SetScrollRegion() up by the
+// given number of rows.  Nothing is redrawn: the rows scrolled
+// out at the top come back at the bottom, and the caller draws
+// the new rows there, using ILI9341_ScrollRow() to find them.
+// Requires 3 bytes of transmission
+// Input: lines rows to scroll up (negative scrolls down)
+// Output: none
+void ILI9341_Scroll(int16_t lines){
+  int32_t offset;
+  uint16_t vsp;
+  if(ScrollHeight == 0) return;
+  offset = (ScrollOffset + lines)%ScrollHeight;
+  if(offset < 0) offset = offset + ScrollHeight;
+  ScrollOffset = offset;
+  vsp = ScrollTop + ScrollOffset;       // panel row shown at the top of the area
+  writecommand(ILI9341_VSCRSADD);
+  writedata(vsp>>8);
+  writedata(vsp&0xFF);
+}
+
+
+//------------ILI9341_ScrollRow------------
+// Find the panel row that is shown at a screen row, so that
+// drawing functions called with the result appear at that row.
+// Input: y screen row
+// Output: row to draw at; y itself outside the scrolling area
+uint16_t ILI9341_ScrollRow(uint16_t y){
+  if((ScrollHeight == 0) || (y < ScrollTop) || (y >= ScrollTop + ScrollHeight)){
+    return y;
+  }
+  return ScrollTop + (y - ScrollTop + ScrollOffset)%ScrollHeight;
+}
+
+
+//------------ILI9341_ScrollRows------------
+// Count the screen rows, starting at y, that are shown by
+// consecutive panel rows, so one address window can cover them.
+// Input: y screen row
+// Output: number of rows from y up to the next edge of the
+//         scrolling area or the point where it wraps
+uint16_t ILI9341_ScrollRows(uint16_t y){
+  uint16_t row;
+  if(ScrollHeight == 0) return ILI9341_TFTHEIGHT - y;
+  if(y < ScrollTop) return ScrollTop - y;
+  if(y >= ScrollTop + ScrollHeight) return ILI9341_TFTHEIGHT - y;
+  row = ILI9341_ScrollRow(y);
+  return ScrollTop + ScrollHeight - row;
 }
 
 
@@ -1291,6 +2635,89 @@ void ILI9341_InvertDisplay(int i) {
     writecommand(ILI9341_INVOFF);
   }
 }
+
+
+//------------ILI9341_SetPartialArea------------
+// Keep only the rows from top to bottom lit.  The panel stops
+// showing the rest of the screen but keeps its memory, so
+// ILI9341_NormalMode() brings the whole screen back as it was,
+// without redrawing.  Drawing outside the area still goes into
+// the panel memory and shows up after ILI9341_NormalMode().
+// Requires 7 bytes of transmission
+// Input: top    first screen row of the area
+//        bottom last screen row of the area
+// Output: 1 if successful, 0 if the orientation does not allow it
+// The area is a band of panel rows, so it only works in
+// rotation 0 or 2.
+int ILI9341_SetPartialArea(uint16_t top, uint16_t bottom){
+  uint16_t sr, er;
+  if((Madctl&MADCTL_MV) || (top > bottom) || (bottom >= ILI9341_TFTHEIGHT)){
+    return 0;
+  }
+  if(Madctl&MADCTL_MY){                 // screen rows run up the panel
+    sr = ILI9341_TFTHEIGHT - 1 - bottom;
+    er = ILI9341_TFTHEIGHT - 1 - top;
+  } else{
+    sr = top;
+    er = bottom;
+  }
+  writecommand(ILI9341_PTLAR);
+  writedata(sr>>8);
+  writedata(sr&0xFF);                   // start row
+  writedata(er>>8);
+  writedata(er&0xFF);                   // end row
+  writecommand(ILI9341_PTLON);
+  return 1;
+}
+
+
+//------------ILI9341_NormalMode------------
+// Light the whole screen again after ILI9341_SetPartialArea().
+// Requires 1 byte of transmission, 4 if a scrolling area is set
+// Input: none
+// Output: none
+void ILI9341_NormalMode(void){
+  writecommand(ILI9341_NORON);
+  if(ScrollHeight){                     // NORON ends scrolling too
+    ILI9341_Scroll(0);
+  }
+}
+
+
+//------------ILI9341_IdleMode------------
+// Switch the panel to 8 colors to save power: red, green and
+// blue are each fully on or off, by the top bit of their field.
+// The panel memory keeps the full colors, so turning idle mode
+// off restores the picture without redrawing.
+// Requires 1 byte of transmission
+// Input: on 0 for full color; non-zero for 8 colors
+// Output: none
+void ILI9341_IdleMode(int on){
+  if(on){
+    writecommand(ILI9341_IDMON);
+  } else{
+    writecommand(ILI9341_IDMOFF);
+  }
+}
+
+
+//------------ILI9341_Sleep------------
+// Put the panel to sleep, with the screen dark and the panel
+// memory and settings kept, or wake it up with the picture it
+// had.  Waits the 5 ms the panel needs before its next command.
+// Requires 1 byte of transmission
+// Input: on non-zero to sleep; 0 to wake up
+// Output: none
+// The panel needs 120 ms after waking up before it can sleep
+// again.
+void ILI9341_Sleep(int on){
+  if(on){
+    writecommand(ILI9341_SLPIN);
+  } else{
+    writecommand(ILI9341_SLPOUT);
+  }
+  Delay1ms(5);
+}
 // graphics routines
 // y coordinates 0 to 31 used for labels and messages
 // y coordinates 32 to 159  128 pixels high
@@ -1299,121 +2726,157 @@ void ILI9341_InvertDisplay(int i) {
 int32_t Ymax,Ymin,X;        // X goes from 0 to 127
 int32_t Yrange; //YrangeDiv2;
 
+// The plot functions only mark pixels in PlotCol[], which holds
+// the colors of column X and of column X+1 (points and lines are
+// two pixels wide).  ILI9341_PlotNext() sends column X, background
+// included, through one 1 by 128 window as a few solid runs, so a
+// column costs one window no matter how many samples were plotted.
+#define PLOT_TOP  32            // first row of the plot
+#define PLOT_ROWS 128           // rows 32 to 159
+static uint16_t PlotCol[2][PLOT_ROWS];  // colors of columns X and X+1
+static uint8_t PlotCur;         // PlotCol[PlotCur] is column X
+static uint16_t PlotBg;         // background color
+static uint64_t YScale;         // 127/Yrange, 32.32 fixed point, rounded up
+
+// Scale y, clipped to Ymin to Ymax, to a row from 159 (Ymin) to 32 (Ymax)
+// Same row as 32+(127*(Ymax-y))/Yrange: rounding YScale up keeps
+// the error under Yrange/2^32, and a row boundary is never nearer
+// than 1/Yrange, so the rows match for any Yrange below 65536.
+int32_t static plotRow(int32_t y){
+  if(y<Ymin) y=Ymin;
+  if(y>Ymax) y=Ymax;
+  return PLOT_TOP + (int32_t)(((uint64_t)(Ymax-y)*YScale)>>32);
+}
+
+// Color rows j1 to j2 (either order) of column X (col=0) or X+1 (col=1)
+void static plotMark(int32_t col, int32_t j1, int32_t j2, uint16_t color){
+  uint16_t *pt = PlotCol[PlotCur^col];
+  int32_t j;
+  if(j1 > j2){
+    j = j1; j1 = j2; j2 = j;
+  }
+  if(j2 > PLOT_TOP+PLOT_ROWS-1) j2 = PLOT_TOP+PLOT_ROWS-1;
+  for(j=j1; j<=j2; j=j+1){
+    pt[j-PLOT_TOP] = color;
+  }
+}
+
+// Send column X as runs of one color, then clear it for X+2
+void static plotFlush(void){
+  uint16_t *pt = PlotCol[PlotCur];
+  int32_t i, start = 0;
+  ILI9341_SetWindow(X, PLOT_TOP, X, PLOT_TOP+PLOT_ROWS-1);
+  for(i=1; i<=PLOT_ROWS; i=i+1){
+    if((i == PLOT_ROWS) || (pt[i] != pt[start])){
+      ILI9341_DMA_FillPixels(pt[start], i-start, 0);
+      start = i;
+    }
+  }
+  for(i=0; i<PLOT_ROWS; i=i+1){
+    pt[i] = PlotBg;
+  }
+  PlotCur = PlotCur^1;
+}
+
 // *************** ILI9341_PlotClear ********************
 // Clear the graphics buffer, set X coordinate to 0
 // This routine clears the display
 // Inputs: ymin and ymax are range of the plot
 // Outputs: none
-void ILI9341_PlotClear(int32_t ymin, int32_t ymax){
-  ILI9341_FillRect(0, 32, 128, 128, ILI9341_Color565(228,228,228)); // light grey
+void ILI9341_PlotClear(int32_t ymin, int32_t ymax){int32_t i;
+  PlotBg = ILI9341_Color565(228,228,228); // light grey
+  ILI9341_FillRect(0, PLOT_TOP, 128, PLOT_ROWS, PlotBg);
   if(ymax>ymin){
     Ymax = ymax;
     Ymin = ymin;
-    Yrange = ymax-ymin;
   } else{
     Ymax = ymin;
     Ymin = ymax;
-    Yrange = ymax-ymin;
   }
+  Yrange = Ymax-Ymin;
+  if(Yrange == 0) Yrange = 1;           // every point plots on the top row
+  YScale = ((127ULL<<32)+Yrange-1)/Yrange;
   //YrangeDiv2 = Yrange/2;
+  for(i=0; i<PLOT_ROWS; i=i+1){
+    PlotCol[0][i] = PlotBg;
+    PlotCol[1][i] = PlotBg;
+  }
+  PlotCur = 0;
   X = 0;
 }
 
 // *************** ILI9341_PlotPoint ********************
 // Used in the voltage versus time plot, plot one point at y
-// It does output to display
+// It does not output to display until ILI9341_PlotNext called
 // Inputs: y is the y coordinate of the point plotted
 // Outputs: none
 void ILI9341_PlotPoint(int32_t y){int32_t j;
-  if(y<Ymin) y=Ymin;
-  if(y>Ymax) y=Ymax;
   // X goes from 0 to 127
   // j goes from 159 to 32
   // y=Ymax maps to j=32
   // y=Ymin maps to j=159
-  j = 32+(127*(Ymax-y))/Yrange;
-  if(j<32) j = 32;
-  if(j>159) j = 159;
-  ILI9341_DrawPixel(X,   j,   ILI9341_BLUE);
-  ILI9341_DrawPixel(X+1, j,   ILI9341_BLUE);
-  ILI9341_DrawPixel(X,   j+1, ILI9341_BLUE);
-  ILI9341_DrawPixel(X+1, j+1, ILI9341_BLUE);
+  j = plotRow(y);
+  plotMark(0, j, j+1, ILI9341_BLUE);
+  plotMark(1, j, j+1, ILI9341_BLUE);
 }
 // *************** ILI9341_PlotLine ********************
 // Used in the voltage versus time plot, plot line to new point
-// It does output to display
+// It does not output to display until ILI9341_PlotNext called
 // Inputs: y is the y coordinate of the point plotted
 // Outputs: none
 int32_t lastj=0;
-void ILI9341_PlotLine(int32_t y){int32_t i,j;
-  if(y<Ymin) y=Ymin;
-  if(y>Ymax) y=Ymax;
+void ILI9341_PlotLine(int32_t y){int32_t j;
   // X goes from 0 to 127
   // j goes from 159 to 32
   // y=Ymax maps to j=32
   // y=Ymin maps to j=159
-  j = 32+(127*(Ymax-y))/Yrange;
-  if(j < 32) j = 32;
-  if(j > 159) j = 159;
+  j = plotRow(y);
   if(lastj < 32) lastj = j;
   if(lastj > 159) lastj = j;
   if(lastj < j){
-    for(i = lastj+1; i<=j ; i++){
-      ILI9341_DrawPixel(X,   i,   ILI9341_BLUE) ;
-      ILI9341_DrawPixel(X+1, i,   ILI9341_BLUE) ;
-    }
+    plotMark(0, lastj+1, j, ILI9341_BLUE);
+    plotMark(1, lastj+1, j, ILI9341_BLUE);
   }else if(lastj > j){
-    for(i = j; i<lastj ; i++){
-      ILI9341_DrawPixel(X,   i,   ILI9341_BLUE) ;
-      ILI9341_DrawPixel(X+1, i,   ILI9341_BLUE) ;
-    }
+    plotMark(0, j, lastj-1, ILI9341_BLUE);
+    plotMark(1, j, lastj-1, ILI9341_BLUE);
   }else{
-    ILI9341_DrawPixel(X,   j,   ILI9341_BLUE) ;
-    ILI9341_DrawPixel(X+1, j,   ILI9341_BLUE) ;
+    plotMark(0, j, j, ILI9341_BLUE);
+    plotMark(1, j, j, ILI9341_BLUE);
   }
   lastj = j;
 }
 
 // *************** ILI9341_PlotPoints ********************
 // Used in the voltage versus time plot, plot two points at y1, y2
-// It does output to display
+// It does not output to display until ILI9341_PlotNext called
 // Inputs: y1 is the y coordinate of the first point plotted
 //         y2 is the y coordinate of the second point plotted
 // Outputs: none
 void ILI9341_PlotPoints(int32_t y1,int32_t y2){int32_t j;
-  if(y1<Ymin) y1=Ymin;
-  if(y1>Ymax) y1=Ymax;
   // X goes from 0 to 127
   // j goes from 159 to 32
   // y=Ymax maps to j=32
   // y=Ymin maps to j=159
-  j = 32+(127*(Ymax-y1))/Yrange;
-  if(j<32) j = 32;
-  if(j>159) j = 159;
-  ILI9341_DrawPixel(X, j, ILI9341_BLUE);
-  if(y2<Ymin) y2=Ymin;
-  if(y2>Ymax) y2=Ymax;
-  j = 32+(127*(Ymax-y2))/Yrange;
-  if(j<32) j = 32;
-  if(j>159) j = 159;
-  ILI9341_DrawPixel(X, j, ILI9341_BLACK);
+  j = plotRow(y1);
+  plotMark(0, j, j, ILI9341_BLUE);
+  j = plotRow(y2);
+  plotMark(0, j, j, ILI9341_BLACK);
 }
 // *************** ILI9341_PlotBar ********************
 // Used in the voltage versus time bar, plot one bar at y
-// It does not output to display until RIT128x96x4ShowPlot called
+// It does not output to display until ILI9341_PlotNext called
 // Inputs: y is the y coordinate of the bar plotted
 // Outputs: none
 void ILI9341_PlotBar(int32_t y){
 int32_t j;
-  if(y<Ymin) y=Ymin;
-  if(y>Ymax) y=Ymax;
   // X goes from 0 to 127
   // j goes from 159 to 32
   // y=Ymax maps to j=32
   // y=Ymin maps to j=159
-  j = 32+(127*(Ymax-y))/Yrange;
-  ILI9341_DrawFastVLine(X, j, 159-j, ILI9341_BLACK);
-
+  j = plotRow(y);
+  if(j < 159){
+    plotMark(0, j, 158, ILI9341_BLACK);
+  }
 }
 
 // full scaled defined as 3V
@@ -1448,7 +2911,7 @@ uint8_t const dBfs[512]={
 // *************** ILI9341_PlotdBfs ********************
 // Used in the amplitude versus frequency plot, plot bar point at y
 // 0 to 0.625V scaled on a log plot from min to max
-// It does output to display
+// It does not output to display until ILI9341_PlotNext called
 // Inputs: y is the y ADC value of the bar plotted
 // Outputs: none
 void ILI9341_PlotdBfs(int32_t y){
@@ -1461,19 +2924,24 @@ int32_t j;
   // y=511 maps to j=32
   // y=0 maps to j=159
   j = dBfs[y];
-  ILI9341_DrawFastVLine(X, j, 159-j, ILI9341_BLACK);
-
+  if(j < 159){
+    plotMark(0, j, 158, ILI9341_BLACK);
+  }
 }
 
 // *************** ILI9341_PlotNext ********************
 // Used in all the plots to step the X coordinate one pixel
 // X steps from 0 to 127, then back to 0 again
-// It does not output to display
+// It outputs column X, background included, to the display
 // Inputs: none
 // Outputs: none
-void ILI9341_PlotNext(void){
+void ILI9341_PlotNext(void){int32_t i;
+  plotFlush();
   if(X==127){
     X = 0;
+    for(i=0; i<PLOT_ROWS; i=i+1){
+      PlotCol[PlotCur][i] = PlotBg;     // drop the half of column 128
+    }
   } else{
     X++;
   }
@@ -1482,16 +2950,12 @@ void ILI9341_PlotNext(void){
 // *************** ILI9341_PlotNextErase ********************
 // Used in all the plots to step the X coordinate one pixel
 // X steps from 0 to 127, then back to 0 again
-// It clears the vertical space into which the next pixel will be drawn
+// It outputs column X; every column is sent with its background,
+// so the space for the next pixel is always clear
 // Inputs: none
 // Outputs: none
 void ILI9341_PlotNextErase(void){
-  if(X==127){
-    X = 0;
-  } else{
-    X++;
-  }
-  ILI9341_DrawFastVLine(X,32,128,ILI9341_Color565(228,228,228));
+  ILI9341_PlotNext();
 }
 
 // Used in all the plots to write buffer to LCD
@@ -1545,32 +3009,72 @@ void ILI9341_PlotNextErase(void){
 // Outputs: none
 void ILI9341_OutChar(char ch){
   if((ch == 10) || (ch == 13) || (ch == 27)){
-    StY++; StX=0;
+    StX=0;
+    if(ConsoleScroll && (StY == 15)){
+      ILI9341_Scroll(20);               // one text line up, clear the bottom line
+      ILI9341_FillRect(0, ILI9341_ScrollRow(15*20), _width, 20, ILI9341_BLACK);
+      return;
+    }
+    StY++;
     if(StY>15){
       StY = 0;
     }
     ILI9341_DrawString(0,StY,"                     ",StTextColor);
     return;
   }
-  ILI9341_DrawCharS(StX*12,StY*20,ch,ILI9341_YELLOW,ILI9341_BLACK, 2); // 6, 10, 1
+  ILI9341_DrawCharS(StX*12,ILI9341_ScrollRow(StY*20),ch,ILI9341_YELLOW,ILI9341_BLACK, 2); // 6, 10, 1
   StX++;
   if(StX>20){
     StX = 20;
-    ILI9341_DrawCharS(StX*6,StY*10,'*',ILI9341_RED,ILI9341_BLACK, 2);
+    ILI9341_DrawCharS(StX*6,ILI9341_ScrollRow(StY*10),'*',ILI9341_RED,ILI9341_BLACK, 2);
   }
   return;
 }
+
+
+//********ILI9341_OutScroll*****************
+// Choose what ILI9341_OutChar() does with a new line on the last
+// text line.  When on, the whole screen is made the scrolling
+// area and the console moves up one line with a single command,
+// and only the new line is cleared.  When off, the cursor wraps
+// to the top line (default).
+// inputs: on  0 to wrap, nonzero to scroll
+// outputs: 1 if successful, 0 if the orientation does not allow scrolling
+int ILI9341_OutScroll(int on){
+  if(on){
+    if(ILI9341_SetScrollRegion(0, ILI9341_TFTHEIGHT-1) == 0){
+      return 0;
+    }
+  } else{
+    ILI9341_SetScrollRegion(0, ILI9341_TFTHEIGHT-1);  // offset back to 0
+  }
+  ConsoleScroll = (on != 0);
+  return 1;
+}
 //********ILI9341_OutString*****************
 // Print a string of characters to the ILI9341 LCD.
 // Position determined by ILI9341_SetCursor command
 // Color set by ILI9341_SetTextColor
 // The string will not automatically wrap.
+// Characters up to the next control character or the end of the
+// line are sent through one address window.
 // inputs: ptr  pointer to NULL-terminated ASCII string
 // outputs: none
 void ILI9341_OutString(char *ptr){
+  int32_t n;
   while(*ptr){
-    ILI9341_OutChar(*ptr);
-    ptr = ptr + 1;
+    n = 0;
+    while(ptr[n] && (ptr[n] != 10) && (ptr[n] != 13) && (ptr[n] != 27) && ((StX+n) < 20)){
+      n = n+1;
+    }
+    if(n > 1){
+      drawGlyphRun(StX*12, ILI9341_ScrollRow(StY*20), ptr, n, ILI9341_YELLOW, ILI9341_BLACK, 2);
+      StX = StX+n;
+      ptr = ptr + n;
+    } else{
+      ILI9341_OutChar(*ptr);
+      ptr = ptr + 1;
+    }
   }
 }
 // ************** ILI9341_SetTextColor ************************
@@ -197,6 +197,11 @@ char Matrix_InChar(void){  char letter;
   return(letter);
 }
 
+// number of keys waiting in the Fifo
+int Matrix_Pending(void){
+  return MatrixFifo_Size();
+}
+
 typedef struct {
 	char num;
 	char chars[10];
@@ -1,65 +1,560 @@
 #include <stdint.h>
 #include "../../inc/tm4c123gh6pm.h"
 #include "../Periphs/inc/ILI9341.h"
+#include "../Periphs/inc/UART_Putty.h"
+#include "../Periphs/inc/matrix.h"
 #include "UI_Components.h"
+#include "UI_Gpu.h"
+#include "UI_Mem.h"
+#include "UI_Sched.h"
 
-/* LITTLE VGL STUFF */	
-void LvGL_Timer0_Init(int32_t period){
-	volatile int delay = 2;
-	SYSCTL_RCGCTIMER_R |= 0x01;   // 0) activate TIMER0
-  delay++;
-	delay = SYSCTL_RCGCTIMER_R;
-	TIMER0_CTL_R = 0x00000000;    // 1) disable TIMER0A during setup
-  TIMER0_CFG_R = 0x00000000;    // 2) configure for 32-bit mode
-  TIMER0_TAMR_R = 0x00000002;   // 3) configure for periodic mode, default down-count settings
-  TIMER0_TAILR_R = period-1;    // 4) reload value
-  TIMER0_TAPR_R = 0;            // 5) bus clock resolution
-  TIMER0_ICR_R = 0x00000001;    // 6) clear TIMER0A timeout flag
-  TIMER0_IMR_R = 0x00000001;    // 7) arm timeout interrupt
-  NVIC_PRI4_R = (NVIC_PRI4_R&0x00FFFFFF)|0x80000000; // 8) priority 4
-// interrupts enabled in the main program after all devices initialized
-// vector number 35, interrupt number 19
-  NVIC_EN0_R = 1<<19;           // 9) enable IRQ 19 in NVIC
-  TIMER0_CTL_R = 0x00000001;    // 10) enable TIMER0A
-}
-
-int isDisplayed = 0;
-void Timer0A_Handler(void) {
-  TIMER0_ICR_R = TIMER_ICR_TATOCINT;// acknowledge timer0A timeout
-	lv_tick_inc(INC_TIME);
-	isDisplayed = 0;
+static lv_disp_buf_t disp_buf;
+static lv_color_t buf1[LV_HOR_RES_MAX * DISP_BUF_LINES];        /*LittlevGL draws a strip of DISP_BUF_LINES rows here*/
+#if DISP_BUF_COUNT == 2
+static lv_color_t buf2[LV_HOR_RES_MAX * DISP_BUF_LINES];        /*and the next strip here while the first is sent*/
+#else
+#define buf2 NULL
+#endif
+lv_disp_drv_t disp_drv;               /*Descriptor of a display driver*/
+
+/* lv_color_t is already the panel's RGB565 (MADCTL is set to BGR order), so a buffer can go out
+ * byte-for-byte when its byte order matches the frames: native halfwords in 16-bit frames
+ * (LV_COLOR_16_SWAP 0) or high byte first in 8-bit frames (LV_COLOR_16_SWAP 1).
+ * Any other pairing costs a byte swap per pixel. */
+static int flushNeedsSwap(void) {
+	return (ILI9341_GetPixelMode() == ILI9341_PIXELS_16BIT) == (LV_COLOR_16_SWAP != 0);
 }
 
+static FlushStats_t FlushStats;
+static uint32_t FlushStart;               /* ILI9341_Cycles() when the area was handed over */
+static enum gov_level GovLevel = GOV_NORMAL;
+static uint32_t GovLevelStart;            /* lv_tick_get() when GovLevel was set */
+static uint32_t GovStart;                 /* lv_tick_get() at FlushStats_Reset */
+static uint32_t GovSleptStart;            /* UI_SchedSleptMs() at FlushStats_Reset */
+static GovStats_t GovStats;
 
-static lv_disp_buf_t disp_buf;
-static lv_color_t buf[LV_HOR_RES_MAX * 20];                     /*Declare a buffer for 10 lines*/
-lv_disp_drv_t disp_drv;               /*Descriptor of a display driver*/
+typedef struct {
+	uint32_t render, flush, pixels, areas;	/* as in FrameProfile_t */
+} frame_t;
+static frame_t Frames[PROFILE_SCREENS][PROFILE_FRAMES];	/* ring of the last frames of each screen */
+static uint32_t FrameCount[PROFILE_SCREENS];
+static unsigned ProfileScreen;
+static frame_t Frame;                     /* the frame being drawn, or the last one until it is stored */
+static unsigned FrameScreen;                 /* its screen */
+static uint8_t FramePending;              /* 1 if Frame drew something and is not stored yet */
+static volatile uint32_t FrameFlushCycles;   /* handover to done of its areas so far */
+static uint32_t FrameFlushCpu;            /* bus cycles inside my_disp_flush for it */
+static lv_task_cb_t RefrTaskCb;           /* LittlevGL's lv_disp_refr_task */
+
+/* Called from the SSI0 interrupt once the last pixel of the area has been queued */
+static void my_flush_done(void) {
+	uint32_t t = ILI9341_Cycles() - FlushStart;
+	FlushStats.cycles += t;
+	FrameFlushCycles += t;
+	if(t > FlushStats.maxCycles) {
+		FlushStats.maxCycles = t;
+	}
+	lv_disp_flush_ready(&disp_drv);         /* Indicate you are ready with the flushing*/
+}
 
+/* Streams n pixels into the open window and calls done after the last one.
+ * The window fills row after row, so a run of one color may wrap onto the next row.
+ * Runs of at least FLUSH_RUN_MIN pixels are sent as fills (the uDMA reads one halfword
+ * over and over); the pixels between them stream from the buffer as before. */
+static void flushPixels(const uint16_t* px, uint32_t n, void (*done)(void)) {
+	uint32_t i, j, lit;
+	if(ILI9341_GetPixelMode() != ILI9341_PIXELS_16BIT || flushNeedsSwap()) {
+		ILI9341_DMA_WritePixels(px, n, done);     /* fills need native 16-bit frames */
+		return;
+	}
+	lit = 0;                                /* first pixel not yet sent */
+	for(i = 0; i < n; i = j) {
+		for(j = i + 1; j < n && px[j] == px[i]; j++) {
+		}
+		if(j - i >= FLUSH_RUN_MIN) {
+			FlushStats.runs++;
+			FlushStats.runPixels += j - i;
+			if(i > lit) {
+				ILI9341_DMA_WritePixels(px + lit, i - lit, 0);
+			}
+			if(j == n) {                    /* window ends with the run */
+				ILI9341_DMA_FillPixels(px[i], j - i, done);
+				return;
+			}
+			ILI9341_DMA_FillPixels(px[i], j - i, 0);
+			lit = j;
+		}
+	}
+	ILI9341_DMA_WritePixels(px + lit, n - lit, done);
+}
+
+/* Opens one address window per area and hands its pixels to the uDMA.
+ * Requires (11 + 2*w*h) bytes of transmission; lv_disp_flush_ready() is called from the
+ * DMA-done interrupt.  The panel's orientation is set in MADCTL (ILI9341_DEFAULT_ROTATION and
+ * ILI9341_DEFAULT_MIRROR), so LVGL coordinates and row order go to the panel unchanged.
+ * Inside a hardware scrolling region (UI_ScrollRegion) screen rows are moved to the panel
+ * rows that show them, and an area that crosses the wrap point takes two windows. */
 void my_disp_flush(lv_disp_t* disp, const lv_area_t* area, lv_color_t* color_p) {
-	int32_t x, y;
-    for(y = area->y1; y <= area->y2; y++) {
-        for(x = area->x1; x <= area->x2; x++) {
-            ILI9341_DrawPixel(x, 319 - y, vGL2ILI_Color(color_p->ch.red, color_p->ch.green, color_p->ch.blue));  /* Put a pixel to the display.*/
-            color_p++;
+	int32_t w = area->x2 - area->x1 + 1;
+	int32_t h = area->y2 - area->y1 + 1;
+	uint32_t n = (uint32_t)(w * h);
+	const uint16_t* px = (const uint16_t*)color_p;
+	int32_t y, rows, row;
+	uint16_t* p;
+	uint32_t t;
+	FlushStart = ILI9341_Cycles();
+	FlushStats.flushes++;
+	FlushStats.pixels += n;
+    if(flushNeedsSwap()) {
+        for(p = (uint16_t*)color_p; p < (uint16_t*)(color_p + n); p++) {
+            *p = (uint16_t)((*p >> 8) | (*p << 8));
         }
     }
-    lv_disp_flush_ready(disp);         /* Indicate you are ready with the flushing*/
+	for(y = area->y1; y <= area->y2; y += rows) {
+		rows = ILI9341_ScrollRows(y);
+		if(rows > area->y2 - y + 1) {
+			rows = area->y2 - y + 1;
+		}
+		row = ILI9341_ScrollRow(y);
+		ILI9341_SetWindow(area->x1, row, area->x2, row + rows - 1);
+		flushPixels(px + (y - area->y1) * w, (uint32_t)(rows * w), (y + rows > area->y2) ? my_flush_done : 0);
+	}
+	t = ILI9341_Cycles() - FlushStart;
+	FlushStats.cpuCycles += t;
+	FrameFlushCpu += t;
+}
+
+#if LV_USE_GPU && LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
+/* LittlevGL calls these for fills and blends wider than its GPU width limit.
+ * fill_area is in pixels of dest_buf, which is dest_width pixels wide. */
+static void my_gpu_fill(lv_disp_drv_t* drv, lv_color_t* dest_buf, lv_coord_t dest_width,
+                        const lv_area_t* fill_area, lv_color_t color) {
+	lv_coord_t y;
+	uint32_t w = (uint32_t)(fill_area->x2 - fill_area->x1 + 1);
+	for(y = fill_area->y1; y <= fill_area->y2; y++) {
+		UI_GpuFill((uint16_t*)&dest_buf[y * dest_width + fill_area->x1], w, color.full);
+	}
+}
+
+static void my_gpu_blend(lv_disp_drv_t* drv, lv_color_t* dest, const lv_color_t* src,
+                         uint32_t length, lv_opa_t opa) {
+	UI_GpuBlend((uint16_t*)dest, (const uint16_t*)src, length, opa);
+}
+#endif
+
+static lv_coord_t ScrollTop, ScrollBottom = -1;
+
+/* Makes screen rows top to bottom a hardware scrolling region for UI_Scroll.
+ * The panel scrolls whole rows, so everything in the band that is not scrolled content
+ * (borders, background) must look the same on every row, e.g. the inside of a text area.
+ * Returns 0 if the panel orientation does not allow scrolling. */
+int UI_ScrollRegion(lv_coord_t top, lv_coord_t bottom) {
+	lv_refr_now(lv_disp_get_default());   /* finish drawing at the old row mapping */
+	if(ILI9341_SetScrollRegion(top, bottom) == 0) {
+		ScrollBottom = -1;
+		return 0;
+	}
+	ScrollTop = top;
+	ScrollBottom = bottom;
+	return 1;
+}
+
+/* Moves content (e.g. the scrollable part of a page or text area) up by dy pixels inside
+ * the scrolling region.  The panel shifts the rows with one command, and only the dy rows
+ * that scrolled into view are invalidated, instead of the whole region.  Everything else is
+ * drawn first, so the areas the move invalidates are the only ones left to drop. */
+void UI_Scroll(lv_obj_t* content, lv_coord_t dy) {
+	lv_disp_t* disp = lv_obj_get_disp(content);
+	lv_area_t band;
+	if(ScrollBottom < ScrollTop || dy == 0 ||
+	   dy > ScrollBottom - ScrollTop || -dy > ScrollBottom - ScrollTop) {
+		lv_obj_set_y(content, lv_obj_get_y(content) - dy);   /* plain redraw */
+		return;
+	}
+	lv_refr_now(disp);                    /* nothing stale may move with the rows */
+	lv_obj_set_y(content, lv_obj_get_y(content) - dy);
+	lv_inv_area(disp, NULL);              /* forget the areas the move invalidated */
+	ILI9341_Scroll(dy);
+	band.x1 = 0;
+	band.x2 = lv_disp_get_hor_res(disp) - 1;
+	if(dy > 0) {                          /* new rows at the bottom */
+		band.y1 = ScrollBottom - dy + 1;
+		band.y2 = ScrollBottom;
+	} else {                              /* new rows at the top */
+		band.y1 = ScrollTop;
+		band.y2 = ScrollTop - dy - 1;
+	}
+	lv_inv_area(disp, &band);
+}
+
+void FlushStats_Get(FlushStats_t* stats) {
+	*stats = FlushStats;
+}
+
+void FlushStats_Reset(void) {
+	FlushStats.flushes = 0;
+	FlushStats.pixels = 0;
+	FlushStats.runs = 0;
+	FlushStats.runPixels = 0;
+	FlushStats.cycles = 0;
+	FlushStats.maxCycles = 0;
+	FlushStats.cpuCycles = 0;
+	ILI9341_ResetStats();
+	GovStats.frames = 0;
+	GovStats.drawMs = 0;
+	GovStats.levelMs[GOV_IDLE] = 0;
+	GovStats.levelMs[GOV_NORMAL] = 0;
+	GovStats.levelMs[GOV_FAST] = 0;
+	GovStart = GovLevelStart = lv_tick_get();
+	GovSleptStart = UI_SchedSleptMs();
+}
+
+/* Prints four lines over UART0, e.g.
+ * "main: 16 areas 76800 px 41 runs 1804 px/run 96% in runs 79312 us 9611 us max 402 us cpu"
+ * "  spi: 52 cmds 153824 bytes 17 windows 61880 us waiting"
+ * "  mem: 2512 used 3104 max 0 fails 16B 5/9 32B 14/20 64B 3/6 96B 25/28+2 region 96/192 656 biggest"
+ * "  gov: 41 frames in 10520 ms 3.8 fps 610 ms drawing 7% cpu 1200/8000/1320 ms fast/normal/idle"
+ * Times are in microseconds at 80 MHz, but for the governor's.  mem is the LittlevGL heap: with LV_MEM_CUSTOM, bytes in
+ * use and the most ever, then blocks in use/most ever for each UI_Mem size class (+ requests
+ * that found it full), then region bytes in use/most ever and its largest free block;
+ * otherwise the built-in pool (LV_MEM_SIZE) as "2512 used 1584 free 1460 biggest 7% frag" */
+void FlushStats_Print(char* name) {
+	ILI9341_Stats_t spi;
+	GovStats_t gov;
+#if LV_MEM_CUSTOM
+	UI_MemStats_t mem;
+	uint16_t c;
+	UI_MemGetStats(&mem);
+#else
+	lv_mem_monitor_t mem;
+	lv_mem_monitor(&mem);
+#endif
+	ILI9341_GetStats(&spi);
+	GovStats_Get(&gov);
+	UART0_OutString(name);
+	UART0_OutString(": ");
+	UART0_OutUDec(FlushStats.flushes);
+	UART0_OutString(" areas ");
+	UART0_OutUDec(FlushStats.pixels);
+	UART0_OutString(" px ");
+	UART0_OutUDec(FlushStats.runs);
+	UART0_OutString(" runs ");
+	UART0_OutUDec(FlushStats.runs ? FlushStats.runPixels / FlushStats.runs : 0);
+	UART0_OutString(" px/run ");
+	UART0_OutUDec(FlushStats.pixels ? (uint32_t)(((uint64_t)FlushStats.runPixels * 100) / FlushStats.pixels) : 0);
+	UART0_OutString("% in runs ");
+	UART0_OutUDec(FlushStats.cycles / 80);
+	UART0_OutString(" us ");
+	UART0_OutUDec(FlushStats.maxCycles / 80);
+	UART0_OutString(" us max ");
+	UART0_OutUDec(FlushStats.cpuCycles / 80);
+	UART0_OutString(" us cpu\r\n  spi: ");
+	UART0_OutUDec(spi.commands);
+	UART0_OutString(" cmds ");
+	UART0_OutUDec(spi.dataBytes);
+	UART0_OutString(" bytes ");
+	UART0_OutUDec(spi.windows);
+	UART0_OutString(" windows ");
+	UART0_OutUDec(spi.waitCycles / 80);
+	UART0_OutString(" us waiting\r\n  mem: ");
+#if LV_MEM_CUSTOM
+	UART0_OutUDec(mem.used);
+	UART0_OutString(" used ");
+	UART0_OutUDec(mem.maxUsed);
+	UART0_OutString(" max ");
+	UART0_OutUDec(mem.failures);
+	UART0_OutString(" fails");
+	for(c = 0; c < UI_MEM_CLASSES; c++) {
+		UART0_OutChar(' ');
+		UART0_OutUDec(mem.classSize[c]);
+		UART0_OutString("B ");
+		UART0_OutUDec(mem.classUsed[c]);
+		UART0_OutChar('/');
+		UART0_OutUDec(mem.classMax[c]);
+		if(mem.classSpill[c]) {
+			UART0_OutChar('+');
+			UART0_OutUDec(mem.classSpill[c]);
+		}
+	}
+	UART0_OutString(" region ");
+	UART0_OutUDec(mem.regionUsed);
+	UART0_OutChar('/');
+	UART0_OutUDec(mem.regionMax);
+	UART0_OutChar(' ');
+	UART0_OutUDec(mem.regionBiggest);
+	UART0_OutString(" biggest\r\n");
+#else
+	UART0_OutUDec(mem.total_size - mem.free_size);
+	UART0_OutString(" used ");
+	UART0_OutUDec(mem.free_size);
+	UART0_OutString(" free ");
+	UART0_OutUDec(mem.free_biggest_size);
+	UART0_OutString(" biggest ");
+	UART0_OutUDec(mem.frag_pct);
+	UART0_OutString("% frag\r\n");
+#endif
+	UART0_OutString("  gov: ");
+	UART0_OutUDec(gov.frames);
+	UART0_OutString(" frames in ");
+	UART0_OutUDec(gov.ms);
+	UART0_OutString(" ms ");
+	UART0_OutUDec(gov.ms ? gov.frames * 1000 / gov.ms : 0);
+	UART0_OutChar('.');
+	UART0_OutUDec(gov.ms ? gov.frames * 10000 / gov.ms % 10 : 0);
+	UART0_OutString(" fps ");
+	UART0_OutUDec(gov.drawMs);
+	UART0_OutString(" ms drawing ");
+	UART0_OutUDec(gov.ms ? (uint32_t)(((uint64_t)gov.cpuMs * 100) / gov.ms) : 0);
+	UART0_OutString("% cpu ");
+	UART0_OutUDec(gov.levelMs[GOV_FAST]);
+	UART0_OutChar('/');
+	UART0_OutUDec(gov.levelMs[GOV_NORMAL]);
+	UART0_OutChar('/');
+	UART0_OutUDec(gov.levelMs[GOV_IDLE]);
+	UART0_OutString(" ms fast/normal/idle\r\n");
+}
+
+/* Times a full-screen fill, a bitmap and a full-screen LVGL redraw at each SSI0 clock
+ * profile and prints one line per profile over UART0, e.g.
+ * "SSI max 20000000 Hz: fill 65536 us bitmap 1667 us flush 112000 us"
+ * img must be a 16-bit true color image; ILI9341_DrawBitmap() takes its rows bottom first,
+ * so it appears upside down.  The clock is left at keep and the screen is redrawn. */
+void UI_SpeedBenchmark(const lv_img_dsc_t* img, enum ILI9341_Speed keep) {
+	static const char* const names[3] = {"safe", "fast", "max"};
+	lv_disp_t* disp = lv_disp_get_default();
+	uint32_t hz, t, fill, bitmap, flush;
+	int s;
+	lv_refr_now(disp);                    /* nothing pending before timing */
+	ILI9341_Async_Wait();
+	for(s = ILI9341_SPEED_SAFE; s <= ILI9341_SPEED_MAX; s++) {
+		hz = ILI9341_SetSpeed((enum ILI9341_Speed)s);
+		t = ILI9341_Cycles();
+		ILI9341_FillScreen(ILI9341_BLACK);
+		ILI9341_Async_Wait();
+		fill = ILI9341_Cycles() - t;
+		t = ILI9341_Cycles();
+		ILI9341_DrawBitmap(0, img->header.h - 1, (const uint16_t*)img->data, img->header.w, img->header.h);
+		ILI9341_Async_Wait();
+		bitmap = ILI9341_Cycles() - t;
+		t = ILI9341_Cycles();
+		lv_obj_invalidate(lv_scr_act());
+		lv_refr_now(disp);
+		ILI9341_Async_Wait();               /* last area leaves from the SSI0 interrupt */
+		flush = ILI9341_Cycles() - t;
+		UART0_OutString("SSI ");
+		UART0_OutString((char*)names[s]);
+		UART0_OutString(" ");
+		UART0_OutUDec(hz);
+		UART0_OutString(" Hz: fill ");
+		UART0_OutUDec(fill / 80);
+		UART0_OutString(" us bitmap ");
+		UART0_OutUDec(bitmap / 80);
+		UART0_OutString(" us flush ");
+		UART0_OutUDec(flush / 80);
+		UART0_OutString(" us\r\n");
+	}
+	ILI9341_SetSpeed(keep);
+}
+
+lv_indev_drv_t keypad_drv;
+lv_indev_t* keypad_indev;
+static uint32_t KeyTime;                  /* lv_tick_get() at the last key */
+
+/* Hands LittlevGL the keys that Timer2A put in the matrix FIFO, each as a press on one read
+ * and a release on the next, so holding a key down does not repeat it */
+static bool keypad_read(lv_indev_drv_t* indev_drv, lv_indev_data_t* data) {
+	static uint32_t lastKey = 0;
+	static bool pressed = false;
+	char key;
+	if(pressed) {
+		pressed = false;
+		data->key = lastKey;
+		data->state = LV_INDEV_STATE_REL;
+		return false;
+	}
+	key = Matrix_InChar();
+	if(key) {
+		lastKey = key;
+		pressed = true;
+		KeyTime = lv_tick_get();
+	}
+	data->key = lastKey;
+	data->state = pressed ? LV_INDEV_STATE_PR : LV_INDEV_STATE_REL;
+	return pressed;                       /*the release is read right away*/
+}
+
+/* Focused objects keep their style; the text area cursor already shows where keys go */
+static void keep_style(lv_group_t* group, lv_style_t* style) {
+}
+
+lv_group_t* createKeyGroup() {
+	lv_group_t* group = lv_group_create();
+	lv_group_set_style_mod_cb(group, keep_style);
+	lv_group_set_style_mod_edit_cb(group, keep_style);
+	return group;
+}
+
+/* REFRESH GOVERNOR */
+static const uint16_t GovRefrMs[3] = {GOV_IDLE_REFR_MS, LV_DISP_DEF_REFR_PERIOD, GOV_FAST_REFR_MS};
+static const uint16_t GovReadMs[3] = {GOV_IDLE_READ_MS, LV_INDEV_DEF_READ_PERIOD, GOV_FAST_READ_MS};
+
+/* Called by LittlevGL after each refresh that drew something */
+static void my_monitor(lv_disp_drv_t* disp_drv, uint32_t time, uint32_t px) {
+	GovStats.frames++;
+	GovStats.drawMs += time;
+	Frame.pixels = px;
+}
+
+/* Stores the last frame in the ring of its screen */
+static void frameStore(void) {
+	if(FramePending) {
+		Frame.flush = FrameFlushCycles / 80;
+		Frames[FrameScreen][FrameCount[FrameScreen] % PROFILE_FRAMES] = Frame;
+		FrameCount[FrameScreen]++;
+		FramePending = 0;
+	}
+}
+
+/* Runs in place of lv_disp_refr_task and times it */
+static void my_refr_task(lv_task_t* task) {
+	lv_disp_t* disp = task->user_data;
+	uint32_t t;
+	frameStore();                         /* its areas went out while LittlevGL waited for this refresh */
+	Frame.areas = disp->inv_p;
+	Frame.pixels = 0;
+	FrameFlushCycles = 0;
+	FrameFlushCpu = 0;
+	t = ILI9341_Cycles();
+	RefrTaskCb(task);
+	if(Frame.pixels && ProfileScreen < PROFILE_SCREENS) {
+		Frame.render = (ILI9341_Cycles() - t - FrameFlushCpu) / 80;
+		FrameScreen = ProfileScreen;
+		FramePending = 1;
+	}
+}
+
+void Profile_SetScreen(unsigned screen) {
+	ProfileScreen = screen;
+}
+
+static void profileStat(ProfileStat_t* stat, uint32_t x, uint32_t i) {
+	if(i == 0) {
+		stat->min = stat->max = stat->avg = x;
+		return;
+	}
+	if(x < stat->min) {
+		stat->min = x;
+	}
+	if(x > stat->max) {
+		stat->max = x;
+	}
+	stat->avg += x;
+}
+
+void Profile_Get(unsigned screen, FrameProfile_t* profile) {
+	uint32_t i, n;
+	frame_t* f;
+	frameStore();
+	n = FrameCount[screen] < PROFILE_FRAMES ? FrameCount[screen] : PROFILE_FRAMES;
+	profile->frames = FrameCount[screen];
+	profile->window = n;
+	profile->render.min = profile->render.avg = profile->render.max = 0;
+	profile->flush = profile->pixels = profile->areas = profile->render;
+	for(i = 0; i < n; i++) {
+		f = &Frames[screen][i];
+		profileStat(&profile->render, f->render, i);
+		profileStat(&profile->flush, f->flush, i);
+		profileStat(&profile->pixels, f->pixels, i);
+		profileStat(&profile->areas, f->areas, i);
+	}
+	if(n) {
+		profile->render.avg /= n;
+		profile->flush.avg /= n;
+		profile->pixels.avg /= n;
+		profile->areas.avg /= n;
+	}
+}
+
+static void outStat(const ProfileStat_t* stat, char* unit) {
+	UART0_OutUDec(stat->min);
+	UART0_OutChar('/');
+	UART0_OutUDec(stat->avg);
+	UART0_OutChar('/');
+	UART0_OutUDec(stat->max);
+	UART0_OutString(unit);
+}
+
+void Profile_Print(unsigned screen, char* name) {
+	FrameProfile_t profile;
+	Profile_Get(screen, &profile);
+	UART0_OutString(name);
+	UART0_OutString(": ");
+	UART0_OutUDec(profile.window);
+	UART0_OutString(" of ");
+	UART0_OutUDec(profile.frames);
+	UART0_OutString(" frames render ");
+	outStat(&profile.render, " us flush ");
+	outStat(&profile.flush, " us ");
+	outStat(&profile.pixels, " px ");
+	outStat(&profile.areas, " areas\r\n");
+}
+
+void UI_Governor() {
+	lv_disp_t* disp = lv_disp_get_default();
+	uint32_t sinceKey = lv_tick_elaps(KeyTime);
+	enum gov_level level;
+	if(sinceKey < GOV_KEY_MS || disp->inv_p > LV_INV_BUF_SIZE / 2) {
+		level = GOV_FAST;
+	} else if(lv_anim_count_running() || sinceKey < GOV_IDLE_MS) {
+		level = GOV_NORMAL;
+	} else {
+		level = GOV_IDLE;
+	}
+	if(level != GovLevel) {
+		GovStats.levelMs[GovLevel] += lv_tick_elaps(GovLevelStart);
+		GovLevelStart = lv_tick_get();
+		GovLevel = level;
+		lv_task_set_period(disp->refr_task, GovRefrMs[level]);
+		lv_task_set_period(keypad_indev->driver.read_task, GovReadMs[level]);
+	}
+}
+
+void GovStats_Get(GovStats_t* stats) {
+	*stats = GovStats;
+	stats->ms = lv_tick_elaps(GovStart);
+	stats->cpuMs = stats->ms - (UI_SchedSleptMs() - GovSleptStart);
+	stats->levelMs[GovLevel] += lv_tick_elaps(GovLevelStart);
+	stats->level = GovLevel;
 }
 
 void LittlevGL_Init() {
-	LvGL_Timer0_Init(INC_TIME * 80000);
+	lv_disp_t* disp;
+	UI_SchedClockInit();                  /*LittlevGL's clock (LV_TICK_CUSTOM), read from lv_init on*/
 	lv_init();
+	UI_SchedInit();
 	/* Set default theme */
 	lv_theme_t * th = lv_theme_night_init(20, NULL);
 	lv_theme_set_current(th);
 	//lv_style_scr.body.main_color = LV_COLOR_RED;
 	//lv_style_scr.body.grad_color = LV_COLOR_RED;
 	
-	lv_disp_buf_init(&disp_buf, buf, NULL, LV_HOR_RES_MAX * 20);    /*Initialize the display buffer*/
+	lv_disp_buf_init(&disp_buf, buf1, buf2, LV_HOR_RES_MAX * DISP_BUF_LINES);    /*Initialize the display buffer*/
 	lv_disp_drv_init(&disp_drv);          /*Basic initialization*/
 	disp_drv.flush_cb = my_disp_flush;    /*Set your driver function*/
 	disp_drv.buffer = &disp_buf;          /*Assign the buffer to the display*/
-	lv_disp_drv_register(&disp_drv);      /*Finally register the driver*/
+	disp_drv.monitor_cb = my_monitor;     /*Frame counts for the governor*/
+#if LV_USE_GPU && LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
+	disp_drv.gpu_fill_cb = my_gpu_fill;   /*Word-wide RGB565 fill and blend (UI_Gpu.c)*/
+	disp_drv.gpu_blend_cb = my_gpu_blend;
+#endif
+	disp = lv_disp_drv_register(&disp_drv);   /*Finally register the driver*/
+	RefrTaskCb = disp->refr_task->task_cb;    /*Profile each refresh (my_refr_task)*/
+	disp->refr_task->task_cb = my_refr_task;
+
+	lv_indev_drv_init(&keypad_drv);
+	keypad_drv.type = LV_INDEV_TYPE_KEYPAD;
+	keypad_drv.read_cb = keypad_read;
+	keypad_indev = lv_indev_drv_register(&keypad_drv);
 }
 
 lv_obj_t* time_label;
@@ -119,10 +614,16 @@ lv_obj_t* createTextIcon(const lv_img_dsc_t* img) {
 
 lv_obj_t* createMainText(char* text) {
 	lv_obj_t* main_label = lv_label_create(lv_scr_act(), NULL);
+	setMainText(main_label, text);
+	return main_label;
+}
+
+/* The scrolling label keeps the width of its text, so it is sized again for the new text */
+void setMainText(lv_obj_t* main_label, char* text) {
+	lv_label_set_long_mode(main_label, LV_LABEL_LONG_EXPAND);
 	lv_label_set_text(main_label, text);                     /*Set the labels text*/
 	lv_obj_align(main_label, NULL, LV_ALIGN_CENTER, 0, -30);
 	lv_label_set_long_mode(main_label, LV_LABEL_LONG_SROLL_CIRC);	
-	return main_label;
 }
 
 lv_obj_t* createPhoneLabel(char* label) {
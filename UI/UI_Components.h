@@ -4,11 +4,146 @@
 #include "../Periphs/inc/ILI9341.h"
 #include "../lvgl/lvgl.h"
 
-#define INC_TIME 5
+/* LittlevGL draw buffers: DISP_BUF_COUNT buffers of DISP_BUF_LINES full-width rows each,
+ * 2*LV_HOR_RES_MAX bytes of SRAM per row.  With two, LittlevGL draws the next strip while
+ * the uDMA sends the last one (my_disp_flush returns before the pixels are out); with one,
+ * it waits for every flush.  2 x 10 rows take the same 9600 bytes as 1 x 20 rows.
+ * Fewer rows mean more, smaller flushes, each with its window and interrupt overhead. */
+#ifndef DISP_BUF_LINES
+#define DISP_BUF_LINES 10
+#endif
+#ifndef DISP_BUF_COUNT
+#define DISP_BUF_COUNT 2
+#endif
+#define FLUSH_RUN_MIN 32	/* shorter runs stream with the other pixels; each fill costs an interrupt */
 
 /* LITTLE VGL STUFF */	
+/* Also registers the matrix keypad (Matrix_Init) as keypad_indev */
 void LittlevGL_Init(void);
 
+/* LV_INDEV_TYPE_KEYPAD input device reading the matrix keypad; keys go to the focused
+ * object of the group set with lv_indev_set_group as LV_SIGNAL_CONTROL, then LV_EVENT_KEY */
+extern lv_indev_t* keypad_indev;
+
+/* Group for the key targets of one screen, drawn without a focus style */
+lv_group_t* createKeyGroup(void);
+
+/* Refresh governor: sets the period of the display refresh task and of the keypad read task
+ * from what the screen is doing.  Fast for GOV_KEY_MS after a key, or while the invalid area
+ * list is half full (a full one redraws the whole screen); normal (LV_DISP_DEF_REFR_PERIOD,
+ * LV_INDEV_DEF_READ_PERIOD) while animations run or up to GOV_IDLE_MS after a key; idle
+ * after that.  With the tickless scheduler a task only wakes the CPU when it has work, so the
+ * periods set how often a busy screen redraws and how many changes one redraw gathers. */
+#ifndef GOV_FAST_REFR_MS
+#define GOV_FAST_REFR_MS 15
+#endif
+#ifndef GOV_FAST_READ_MS
+#define GOV_FAST_READ_MS 10
+#endif
+#ifndef GOV_IDLE_REFR_MS
+#define GOV_IDLE_REFR_MS 100
+#endif
+#ifndef GOV_IDLE_READ_MS
+#define GOV_IDLE_READ_MS 50
+#endif
+#define GOV_KEY_MS 1000
+#define GOV_IDLE_MS 10000
+
+enum gov_level {
+	GOV_IDLE,
+	GOV_NORMAL,
+	GOV_FAST
+};
+
+/* Call once per pass of the main loop, before sleeping */
+void UI_Governor(void);
+
+typedef struct {
+	uint32_t ms;			/* since FlushStats_Reset */
+	uint32_t frames;		/* display refreshes that drew something */
+	uint32_t drawMs;		/* ms LittlevGL spent in them */
+	uint32_t cpuMs;			/* ms the CPU was awake (not in UI_SchedSleep) */
+	uint32_t levelMs[3];	/* ms at each gov_level */
+	enum gov_level level;	/* level now */
+} GovStats_t;
+
+void GovStats_Get(GovStats_t* stats);
+
+/* Solid-color run statistics of the display flush */
+typedef struct {
+	uint32_t flushes;		/* areas flushed */
+	uint32_t pixels;		/* pixels flushed */
+	uint32_t runs;			/* runs of at least FLUSH_RUN_MIN pixels, sent as fills */
+	uint32_t runPixels;	/* pixels in those runs */
+	uint32_t cycles;		/* bus cycles from my_disp_flush to flush ready, all areas */
+	uint32_t maxCycles;	/* the same for the slowest area */
+	uint32_t cpuCycles;	/* bus cycles spent inside my_disp_flush */
+} FlushStats_t;
+
+void FlushStats_Get(FlushStats_t* stats);
+
+/* Also resets the driver's SPI counters (ILI9341_ResetStats) and the governor's */
+void FlushStats_Reset(void);
+
+/* Dumps the flush statistics, the driver's SPI counters, the LittlevGL heap use and the
+ * governor's frame rate and CPU share over UART0 */
+void FlushStats_Print(char* name);
+
+/* The screens main.c shows; NUM_SCREENS is how many there are */
+enum screens {
+	MAIN_SCREEN,
+	CALL_SCREEN,
+	TEXT_SCREEN,
+	CALL_BUSY_SCREEN,
+	TEXT_BUSY_SCREEN,
+	NUM_SCREENS
+};
+
+/* Per-frame profile.  Each refresh of LittlevGL's refresh task that draws something is one
+ * frame, kept in the slot of the screen set with Profile_SetScreen (an enum screens value).
+ * min/avg/max are over the last PROFILE_FRAMES frames of the slot.  A frame's flush
+ * time is complete once its last area is out, so it is stored when the next refresh starts
+ * or Profile_Get is called. */
+#ifndef PROFILE_SCREENS
+#define PROFILE_SCREENS NUM_SCREENS
+#endif
+#ifndef PROFILE_FRAMES
+#define PROFILE_FRAMES 8
+#endif
+
+typedef struct {
+	uint32_t min, avg, max;
+} ProfileStat_t;
+
+typedef struct {
+	uint32_t frames;		/* frames drawn on the screen */
+	uint32_t window;		/* the last of them that the rest is over, at most PROFILE_FRAMES */
+	ProfileStat_t render;	/* us in the refresh task outside my_disp_flush, waits for a free draw buffer included */
+	ProfileStat_t flush;	/* us from my_disp_flush to the panel having the pixels, summed over the areas */
+	ProfileStat_t pixels;	/* pixels drawn */
+	ProfileStat_t areas;	/* invalid areas when the refresh started, before LittlevGL joins them */
+} FrameProfile_t;
+
+/* Frames from now on go to this screen's slot; screens past PROFILE_SCREENS are not kept */
+void Profile_SetScreen(unsigned screen);
+
+void Profile_Get(unsigned screen, FrameProfile_t* profile);
+
+/* Prints one line over UART0, e.g.
+ * "main: 8 of 41 frames render 2100/3400/9100 us flush 900/2500/8000 us 1200/4800/76800 px 1/2/6 areas"
+ * with min/avg/max of the last PROFILE_FRAMES frames */
+void Profile_Print(unsigned screen, char* name);
+
+/* Prints fill, bitmap and full-screen redraw times at each SSI0 clock profile over UART0;
+ * img is drawn with ILI9341_DrawBitmap, so it must be LV_IMG_CF_TRUE_COLOR */
+void UI_SpeedBenchmark(const lv_img_dsc_t* img, enum ILI9341_Speed keep);
+
+/* Hardware scrolling: content moved with UI_Scroll inside the rows of UI_ScrollRegion
+ * costs one panel command and a redraw of only the rows that come into view */
+int UI_ScrollRegion(lv_coord_t top, lv_coord_t bottom);
+
+void UI_Scroll(lv_obj_t* content, lv_coord_t dy);
+
 lv_obj_t* createTime(char* text, int x, int y, int w, int h);
 
 lv_obj_t* createSlider(void);
@@ -19,6 +154,9 @@ lv_obj_t* createTextIcon(const lv_img_dsc_t* img);
 
 lv_obj_t* createMainText(char* text);
 
+/* New text for a createMainText label, centered again */
+void setMainText(lv_obj_t* main_label, char* text);
+
 lv_obj_t* createPhoneTextArea(void);
 
 lv_obj_t* createTextMessageArea(void);
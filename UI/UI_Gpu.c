@@ -0,0 +1,69 @@
+#include <stdint.h>
+#include "UI_Gpu.h"
+
+/* A word holds two RGB565 pixels.  Shifting and masking it gives one channel of both pixels,
+ * each in its own halfword lane, so one 32-bit multiply scales both.  No lane carries into
+ * the next: the largest sum, 63*opa + 63*(255-opa), is below 65536. */
+#define LANES_R(p)	(((p) >> 11) & 0x001F001F)
+#define LANES_G(p)	(((p) >> 5) & 0x003F003F)
+#define LANES_B(p)	((p) & 0x001F001F)
+
+/* Blends the two pixels of s over the two of d; a single pixel can go in the low halfword */
+static uint32_t blend2(uint32_t s, uint32_t d, uint32_t mix, uint32_t inv) {
+	uint32_t r = ((LANES_R(s) * mix + LANES_R(d) * inv) >> 8) & 0x00FF00FF;
+	uint32_t g = ((LANES_G(s) * mix + LANES_G(d) * inv) >> 8) & 0x00FF00FF;
+	uint32_t b = ((LANES_B(s) * mix + LANES_B(d) * inv) >> 8) & 0x00FF00FF;
+	return (r << 11) | (g << 5) | b;
+}
+
+void UI_GpuFill(uint16_t* dest, uint32_t n, uint16_t color) {
+	uint32_t c2 = color | ((uint32_t)color << 16);
+	uint32_t* d;
+	if(n && ((uintptr_t)dest & 2)) {        /* one halfword to reach a word boundary */
+		*dest++ = color;
+		n--;
+	}
+	d = (uint32_t*)dest;
+	for(; n >= 8; n -= 8) {
+		d[0] = c2;
+		d[1] = c2;
+		d[2] = c2;
+		d[3] = c2;
+		d += 4;
+	}
+	for(; n >= 2; n -= 2) {
+		*d++ = c2;
+	}
+	if(n) {
+		*(uint16_t*)d = color;
+	}
+}
+
+void UI_GpuBlend(uint16_t* dest, const uint16_t* src, uint32_t n, uint8_t opa) {
+	uint32_t mix = opa, inv = 255 - opa;
+	uint32_t* d;
+	if(n && ((uintptr_t)dest & 2)) {        /* one pixel to reach a word boundary */
+		*dest = (uint16_t)blend2(*src, *dest, mix, inv);
+		dest++;
+		src++;
+		n--;
+	}
+	d = (uint32_t*)dest;
+	if(((uintptr_t)src & 2) == 0) {         /* both aligned: whole words */
+		const uint32_t* s = (const uint32_t*)src;
+		for(; n >= 2; n -= 2) {
+			*d = blend2(*s++, *d, mix, inv);
+			d++;
+		}
+		src = (const uint16_t*)s;
+	} else {                                /* src is a halfword off: build its words */
+		for(; n >= 2; n -= 2) {
+			*d = blend2(src[0] | ((uint32_t)src[1] << 16), *d, mix, inv);
+			d++;
+			src += 2;
+		}
+	}
+	if(n) {
+		*(uint16_t*)d = (uint16_t)blend2(*src, *(uint16_t*)d, mix, inv);
+	}
+}
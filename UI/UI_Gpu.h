@@ -0,0 +1,13 @@
+#include <stdint.h>
+
+/* RGB565 kernels behind the LittlevGL GPU callbacks (LV_USE_GPU, see LittlevGL_Init).
+ * They work two pixels per 32-bit word, so the buffers are read and written a word at a time;
+ * any halfword alignment of dest and src is allowed.  Plain C on uint16_t pixels, with no
+ * LittlevGL or TM4C123 dependency, so they also build on a PC. */
+
+/* Sets n pixels at dest to color */
+void UI_GpuFill(uint16_t* dest, uint32_t n, uint16_t color);
+
+/* Mixes n pixels of src over dest with opacity opa (0 to 255), the same as LittlevGL's
+ * dest[i] = lv_color_mix(src[i], dest[i], opa): each channel is (s*opa + d*(255-opa)) >> 8 */
+void UI_GpuBlend(uint16_t* dest, const uint16_t* src, uint32_t n, uint8_t opa);
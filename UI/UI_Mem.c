@@ -0,0 +1,174 @@
+#include <stdint.h>
+#include <stddef.h>
+#include "UI_Mem.h"
+
+/* Only LittlevGL calls these, and it only runs in the main loop, so there is no critical section */
+
+#define POOL_WORDS	((UI_MEM_SIZE0*UI_MEM_COUNT0 + UI_MEM_SIZE1*UI_MEM_COUNT1 + \
+					  UI_MEM_SIZE2*UI_MEM_COUNT2 + UI_MEM_SIZE3*UI_MEM_COUNT3) / 4)
+
+static const uint16_t ClassSize[UI_MEM_CLASSES] = {UI_MEM_SIZE0, UI_MEM_SIZE1, UI_MEM_SIZE2, UI_MEM_SIZE3};
+static const uint16_t ClassCount[UI_MEM_CLASSES] = {UI_MEM_COUNT0, UI_MEM_COUNT1, UI_MEM_COUNT2, UI_MEM_COUNT3};
+
+static uint32_t Pool[POOL_WORDS];				/* the classes, one after the other */
+static uint8_t* ClassEnd[UI_MEM_CLASSES];		/* first byte after each class */
+static void* ClassFree[UI_MEM_CLASSES];			/* free blocks, each holding a pointer to the next */
+
+/* A free block of the region starts with its size and the next free block, in address order.
+ * A block in use keeps only the size, so its data starts 4 bytes in. */
+typedef struct region_block {
+	uint32_t size;								/* bytes, this word included */
+	struct region_block* next;
+} region_block_t;
+
+#define REGION_ALIGN	8
+
+static uint32_t Region[UI_MEM_REGION / 4];
+static region_block_t* RegionFree;
+
+static UI_MemStats_t Stats;
+static uint8_t Ready;
+
+static void memInit(void) {
+	uint8_t* p = (uint8_t*)Pool;
+	uint16_t c, i;
+	for(c = 0; c < UI_MEM_CLASSES; c++) {
+		ClassFree[c] = NULL;
+		for(i = 0; i < ClassCount[c]; i++) {	/* chained back to front so the first block is handed out first */
+			uint8_t* b = p + (uint32_t)(ClassCount[c] - 1 - i) * ClassSize[c];
+			*(void**)b = ClassFree[c];
+			ClassFree[c] = b;
+		}
+		p += (uint32_t)ClassCount[c] * ClassSize[c];
+		ClassEnd[c] = p;
+	}
+	RegionFree = (region_block_t*)Region;
+	RegionFree->size = UI_MEM_REGION;
+	RegionFree->next = NULL;
+	Ready = 1;
+}
+
+static void* regionAlloc(size_t size) {
+	region_block_t** link = &RegionFree;
+	region_block_t* b;
+	uint32_t need = (size + 4 + REGION_ALIGN - 1) & ~(uint32_t)(REGION_ALIGN - 1);
+	if(need < sizeof(region_block_t)) {
+		need = sizeof(region_block_t);
+	}
+	for(b = RegionFree; b != NULL; b = b->next) {	/* first fit */
+		if(b->size >= need) {
+			if(b->size - need >= sizeof(region_block_t)) {	/* split off the rest */
+				region_block_t* rest = (region_block_t*)((uint8_t*)b + need);
+				rest->size = b->size - need;
+				rest->next = b->next;
+				*link = rest;
+			} else {								/* too little left over to be a block */
+				need = b->size;
+				*link = b->next;
+			}
+			b->size = need;
+			Stats.regionUsed += need;
+			if(Stats.regionUsed > Stats.regionMax) {
+				Stats.regionMax = Stats.regionUsed;
+			}
+			Stats.used += need;
+			return (uint8_t*)b + 4;
+		}
+		link = &b->next;
+	}
+	return NULL;
+}
+
+static void regionFree(void* p) {
+	region_block_t* b = (region_block_t*)((uint8_t*)p - 4);
+	region_block_t* prev = NULL;
+	region_block_t* next = RegionFree;
+	Stats.regionUsed -= b->size;
+	Stats.used -= b->size;
+	while(next != NULL && next < b) {
+		prev = next;
+		next = next->next;
+	}
+	if(next != NULL && (uint8_t*)b + b->size == (uint8_t*)next) {	/* join the block after */
+		b->size += next->size;
+		next = next->next;
+	}
+	b->next = next;
+	if(prev != NULL && (uint8_t*)prev + prev->size == (uint8_t*)b) {	/* join the block before */
+		prev->size += b->size;
+		prev->next = next;
+	} else if(prev != NULL) {
+		prev->next = b;
+	} else {
+		RegionFree = b;
+	}
+}
+
+void* UI_Malloc(size_t size) {
+	void* p;
+	uint16_t c, first;
+	if(!Ready) {
+		memInit();
+	}
+	for(first = 0; first < UI_MEM_CLASSES && size > ClassSize[first]; first++) {
+	}
+	for(c = first; c < UI_MEM_CLASSES; c++) {
+		if(ClassFree[c] != NULL) {
+			p = ClassFree[c];
+			ClassFree[c] = *(void**)p;
+			if(++Stats.classUsed[c] > Stats.classMax[c]) {
+				Stats.classMax[c] = Stats.classUsed[c];
+			}
+			Stats.used += ClassSize[c];
+			if(Stats.used > Stats.maxUsed) {
+				Stats.maxUsed = Stats.used;
+			}
+			return p;
+		}
+		if(c == first) {
+			Stats.classSpill[c]++;
+		}
+	}
+	p = regionAlloc(size);
+	if(p == NULL) {
+		Stats.failures++;
+	} else if(Stats.used > Stats.maxUsed) {
+		Stats.maxUsed = Stats.used;
+	}
+	return p;
+}
+
+void UI_Free(void* p) {
+	uint16_t c;
+	if(p == NULL) {
+		return;
+	}
+	if((uint8_t*)p >= (uint8_t*)Pool && (uint8_t*)p < ClassEnd[UI_MEM_CLASSES - 1]) {
+		for(c = 0; (uint8_t*)p >= ClassEnd[c]; c++) {
+		}
+		*(void**)p = ClassFree[c];
+		ClassFree[c] = p;
+		Stats.classUsed[c]--;
+		Stats.used -= ClassSize[c];
+	} else {
+		regionFree(p);
+	}
+}
+
+void UI_MemGetStats(UI_MemStats_t* stats) {
+	region_block_t* b;
+	uint16_t c;
+	if(!Ready) {
+		memInit();
+	}
+	for(c = 0; c < UI_MEM_CLASSES; c++) {
+		Stats.classSize[c] = ClassSize[c];
+	}
+	Stats.regionBiggest = 0;
+	for(b = RegionFree; b != NULL; b = b->next) {
+		if(b->size > Stats.regionBiggest) {
+			Stats.regionBiggest = b->size;
+		}
+	}
+	*stats = Stats;
+}
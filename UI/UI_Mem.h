@@ -0,0 +1,53 @@
+#include <stdint.h>
+#include <stddef.h>
+
+/* LittlevGL heap (LV_MEM_CUSTOM in lv_conf.h).  Requests go to the smallest size class with a
+ * free block, or to the next larger class when that one is full; requests bigger than the
+ * largest class, or that find every class full, go to a first-fit region whose free blocks
+ * are joined as they are freed.  Every class is a fixed array of equal blocks, so creating
+ * and deleting objects cannot fragment it.  LittlevGL adds a 4-byte header to each request.
+ * Size the classes from UI_MemGetStats (printed by FlushStats_Print) after visiting every
+ * screen: classMax is the most blocks ever used, classSpill the requests that did not fit. */
+
+/* Block size in bytes (a multiple of 4) and number of blocks of each size class.
+ * Classes and region together take 4096 bytes, the LV_MEM_SIZE pool they replace; move bytes
+ * between them as the stats show, rather than adding more. */
+#define UI_MEM_CLASSES	4
+#define UI_MEM_SIZE0	16
+#define UI_MEM_COUNT0	16
+#define UI_MEM_SIZE1	32
+#define UI_MEM_COUNT1	16
+#define UI_MEM_SIZE2	64
+#define UI_MEM_COUNT2	8
+#define UI_MEM_SIZE3	96
+#define UI_MEM_COUNT3	16
+
+/* Bytes in the fallback region (a multiple of 8).  While an LV_IMG_CF_INDEXED_8BIT image is
+ * open (the call and text icons in main.c) LittlevGL holds its decoded palette here: 256 colors
+ * and 256 opacities, 520 + 264 bytes with headers, one image at a time with
+ * LV_IMG_CACHE_DEF_SIZE 1.  That is the least the region can be; the rest is for labels and
+ * other requests bigger than the largest class.
+ * High-water marks on the board, from the mem: line after visiting every screen:
+ *   not yet recorded; these sizes are the first guess, not a measurement. */
+#define UI_MEM_REGION	1280
+
+typedef struct {
+	uint32_t used;				/* bytes of blocks handed out now */
+	uint32_t maxUsed;			/* the most there have ever been */
+	uint32_t failures;			/* requests that got NULL */
+	uint16_t classSize[UI_MEM_CLASSES];	/* block size of each class in bytes */
+	uint16_t classUsed[UI_MEM_CLASSES];	/* blocks of each class in use */
+	uint16_t classMax[UI_MEM_CLASSES];	/* the most there have ever been */
+	uint16_t classSpill[UI_MEM_CLASSES];	/* requests for the class that it was too full to take */
+	uint32_t regionUsed;		/* bytes of the region in use, headers included */
+	uint32_t regionMax;			/* the most there have ever been */
+	uint32_t regionBiggest;		/* largest free block in the region now */
+} UI_MemStats_t;
+
+/* LV_MEM_CUSTOM_ALLOC: returns a 4-byte aligned block of at least size bytes, or NULL */
+void* UI_Malloc(size_t size);
+
+/* LV_MEM_CUSTOM_FREE: returns a block from UI_Malloc; NULL is ignored */
+void UI_Free(void* p);
+
+void UI_MemGetStats(UI_MemStats_t* stats);
@@ -0,0 +1,143 @@
+#include <stdint.h>
+#include "../../inc/tm4c123gh6pm.h"
+#include "../lvgl/lvgl.h"
+#include "../lvgl/src/lv_misc/lv_gc.h"
+#include "../Periphs/inc/matrix.h"
+#include "UI_Components.h"
+#include "UI_Sched.h"
+
+long StartCritical (void);    // previous I bit, disable interrupts
+void EndCritical(long sr);    // restore I bit to previous value
+void WaitForInterrupt(void);  // low power mode
+
+#define COUNTS_PER_MS 80000		/* 80 MHz bus clock */
+
+static volatile uint32_t TickMs;	/* ms up to the start of the current period */
+static volatile uint32_t PeriodMs;	/* length of the current period */
+static lv_task_t* AnimTask;
+static uint32_t SleptMs;			/* time spent in UI_SchedSleep */
+static uint32_t SleptCycles;		/* and the part of a ms not yet in SleptMs */
+
+void UI_SchedClockInit(void) {
+	volatile int delay = 2;
+	SYSCTL_RCGCTIMER_R |= 0x01;   // 0) activate TIMER0
+	delay++;
+	delay = SYSCTL_RCGCTIMER_R;
+	TickMs = 0;
+	PeriodMs = UI_SCHED_MAX_MS;
+	TIMER0_CTL_R = 0x00000000;    // 1) disable TIMER0A during setup
+	TIMER0_CFG_R = 0x00000000;    // 2) configure for 32-bit mode
+	TIMER0_TAMR_R = 0x00000002;   // 3) configure for periodic mode, default down-count settings
+	TIMER0_TAILR_R = UI_SCHED_MAX_MS * COUNTS_PER_MS - 1;    // 4) reload value
+	TIMER0_TAPR_R = 0;            // 5) bus clock resolution
+	TIMER0_ICR_R = 0x00000001;    // 6) clear TIMER0A timeout flag
+	TIMER0_IMR_R = 0x00000001;    // 7) arm timeout interrupt
+	NVIC_PRI4_R = (NVIC_PRI4_R&0x00FFFFFF)|0x80000000; // 8) priority 4
+// interrupts enabled in the main program after all devices initialized
+// vector number 35, interrupt number 19
+	NVIC_EN0_R = 1<<19;           // 9) enable IRQ 19 in NVIC
+	TIMER0_CTL_R = 0x00000001;    // 10) enable TIMER0A
+}
+
+/* Counts into the current period; *ended is set if a period ended that Timer0A_Handler has
+ * not counted yet, in which case the counts are into the period after it */
+static uint32_t readTimer(uint32_t* ended) {
+	uint32_t counts;
+	do {
+		*ended = TIMER0_RIS_R & TIMER_RIS_TATORIS;
+		counts = TIMER0_TAILR_R - TIMER0_TAV_R;
+	} while(*ended != (TIMER0_RIS_R & TIMER_RIS_TATORIS));
+	return counts;
+}
+
+/* Ends the current period ms from now, keeping the time already counted (less the few cycles
+ * between reading and writing the counter); interrupts off */
+static void setPeriod(uint32_t ms) {
+	uint32_t ended;
+	uint32_t counts = readTimer(&ended);
+	if(ended) {
+		TIMER0_ICR_R = TIMER_ICR_TATOCINT;
+		TickMs += PeriodMs;
+	}
+	TickMs += counts / COUNTS_PER_MS;
+	PeriodMs = ms;
+	TIMER0_TAILR_R = ms * COUNTS_PER_MS - 1;
+	TIMER0_TAV_R = ms * COUNTS_PER_MS - 1 - counts % COUNTS_PER_MS;
+}
+
+void Timer0A_Handler(void) {
+	if(TIMER0_MIS_R & TIMER_MIS_TATOMIS) {	/* setPeriod may have counted the period already */
+		TIMER0_ICR_R = TIMER_ICR_TATOCINT;	// acknowledge timer0A timeout
+		TickMs += PeriodMs;
+		if(PeriodMs != UI_SCHED_MAX_MS) {	/* the end of a sleep; back to long periods */
+			setPeriod(UI_SCHED_MAX_MS);
+		}
+	}
+}
+
+/* Bus cycles since UI_SchedClockInit, modulo 2^32; interrupts off */
+static uint32_t cycles(void) {
+	uint32_t ended;
+	uint32_t counts = readTimer(&ended);
+	return (TickMs + (ended ? PeriodMs : 0)) * COUNTS_PER_MS + counts;
+}
+
+uint32_t UI_Millis(void) {
+	uint32_t ended, counts, ms;
+	long sr = StartCritical();
+	counts = readTimer(&ended);
+	ms = TickMs + (ended ? PeriodMs : 0) + counts / COUNTS_PER_MS;
+	EndCritical(sr);
+	return ms;
+}
+
+void UI_SchedInit(void) {
+	AnimTask = lv_ll_get_head(&LV_GC_ROOT(_lv_task_ll));
+}
+
+uint32_t UI_SchedNextDue(void) {
+	lv_disp_t* disp = lv_disp_get_default();
+	uint32_t due = UI_SCHED_MAX_MS;
+	uint32_t elapsed;
+	lv_task_t* task;
+	LV_LL_READ(LV_GC_ROOT(_lv_task_ll), task) {
+		if(task->prio == LV_TASK_PRIO_OFF) {
+			continue;
+		}
+		if(disp != NULL && task == disp->refr_task && disp->inv_p == 0) {
+			continue;                         /*nothing to redraw*/
+		}
+		if(keypad_indev != NULL && task == keypad_indev->driver.read_task && Matrix_Pending() == 0) {
+			continue;                         /*no key to read*/
+		}
+		if(task == AnimTask && lv_anim_count_running() == 0) {
+			continue;
+		}
+		elapsed = lv_tick_elaps(task->last_run);
+		if(elapsed >= task->period) {
+			return 0;
+		}
+		if(task->period - elapsed < due) {
+			due = task->period - elapsed;
+		}
+	}
+	return due;
+}
+
+void UI_SchedSleep(void) {
+	uint32_t ms = UI_SchedNextDue();
+	uint32_t t;
+	if(ms == 0) {
+		return;
+	}
+	setPeriod(ms);
+	t = cycles();
+	WaitForInterrupt();
+	SleptCycles += cycles() - t;
+	SleptMs += SleptCycles / COUNTS_PER_MS;
+	SleptCycles = SleptCycles % COUNTS_PER_MS;
+}
+
+uint32_t UI_SchedSleptMs(void) {
+	return SleptMs;
+}
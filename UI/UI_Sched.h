@@ -0,0 +1,31 @@
+#include <stdint.h>
+
+/* Tickless LittlevGL scheduling.  Timer0A keeps LittlevGL's clock (LV_TICK_CUSTOM) without
+ * a periodic tick: it counts down one long period at a time, and UI_SchedSleep moves the end
+ * of the current period to the moment the next LittlevGL task is due and waits for it, or for
+ * any other interrupt (keypad scan, clock, SSI0, UART), with WFI. */
+
+/* Longest sleep and longest Timer0A period, in ms (at most 53687) */
+#define UI_SCHED_MAX_MS 1000
+
+/* Starts the clock; call before lv_init, which reads it */
+void UI_SchedClockInit(void);
+
+/* LV_TICK_CUSTOM_SYS_TIME_EXPR: ms since UI_SchedClockInit */
+uint32_t UI_Millis(void);
+
+/* Call right after lv_init, while the only LittlevGL task is its animation task */
+void UI_SchedInit(void);
+
+/* ms until a LittlevGL task has work to do, at most UI_SCHED_MAX_MS.  The refresh task counts
+ * only with areas to redraw, the keypad task only with a key in the FIFO and the animation
+ * task only with animations running; any other task, when its period is up. */
+uint32_t UI_SchedNextDue(void);
+
+/* Sleeps until UI_SchedNextDue or the next interrupt.  Call with interrupts disabled, after
+ * checking that the main loop has nothing to do, so an interrupt that comes in between
+ * still ends the sleep; it is handled once interrupts are enabled again. */
+void UI_SchedSleep(void);
+
+/* ms spent in UI_SchedSleep since UI_SchedClockInit; the rest of UI_Millis is CPU time */
+uint32_t UI_SchedSleptMs(void);
@@ -32,7 +32,10 @@
 #define LV_COLOR_DEPTH     16
 
 /* Swap the 2 bytes of RGB565 color.
- * Useful if the display has a 8 bit interface (e.g. SPI)*/
+ * Useful if the display has a 8 bit interface (e.g. SPI)
+ * The ILI9341 is in BGR order, so lv_color_t is already the panel's color.
+ * 0 matches ILI9341_PIXELS_16BIT frames, 1 matches ILI9341_PIXELS_8BIT frames;
+ * my_disp_flush() swaps the bytes itself for the other pairings.*/
 #define LV_COLOR_16_SWAP   0
 
 /* 1: Enable screen transparency.
@@ -69,7 +72,7 @@ typedef int16_t lv_coord_t;
  * The graphical objects and other related data are stored here. */
 
 /* 1: use custom malloc/free, 0: use the built-in `lv_mem_alloc` and `lv_mem_free` */
-#define LV_MEM_CUSTOM      0
+#define LV_MEM_CUSTOM      1
 #if LV_MEM_CUSTOM == 0
 /* Size of the memory used by `lv_mem_alloc` in bytes (>= 2kB)*/
 #  define LV_MEM_SIZE    (4U * 1024U)
@@ -84,9 +87,13 @@ typedef int16_t lv_coord_t;
 /* Automatically defrag. on free. Defrag. means joining the adjacent free cells. */
 #  define LV_MEM_AUTO_DEFRAG  1
 #else       /*LV_MEM_CUSTOM*/
-#  define LV_MEM_CUSTOM_INCLUDE "heap.h"   /*Header for the dynamic memory function*/
-#  define LV_MEM_CUSTOM_ALLOC   Heap_Malloc       /*Wrapper to malloc*/
-#  define LV_MEM_CUSTOM_FREE    Heap_Free         /*Wrapper to free*/
+#  define LV_MEM_CUSTOM_INCLUDE <stddef.h>   /*Header for the dynamic memory function*/
+#  define LV_MEM_CUSTOM_ALLOC   UI_Malloc         /*Size-class pools, UI/UI_Mem.c*/
+#  define LV_MEM_CUSTOM_FREE    UI_Free           /*Wrapper to free*/
+/* Declared here as well as in UI/UI_Mem.h: the project has no include path to UI/ from lvgl/ */
+#include <stddef.h>
+void * UI_Malloc(size_t size);
+void UI_Free(void * p);
 #endif     /*LV_MEM_CUSTOM*/
 
 /* Garbage Collector settings
@@ -210,10 +217,13 @@ typedef void * lv_img_decoder_user_data_t;
 
 /* 1: use a custom tick source.
  * It removes the need to manually update the tick with `lv_tick_inc`) */
-#define LV_TICK_CUSTOM     0
+#define LV_TICK_CUSTOM     1
 #if LV_TICK_CUSTOM == 1
-#define LV_TICK_CUSTOM_INCLUDE  "something.h"       /*Header for the sys time function*/
-#define LV_TICK_CUSTOM_SYS_TIME_EXPR (millis())     /*Expression evaluating to current systime in ms*/
+#define LV_TICK_CUSTOM_INCLUDE  <stdint.h>          /*Header for the sys time function*/
+#define LV_TICK_CUSTOM_SYS_TIME_EXPR (UI_Millis())  /*Timer0A, UI/UI_Sched.c*/
+/* Declared here as well as in UI/UI_Sched.h: the project has no include path to UI/ from lvgl/ */
+#include <stdint.h>
+uint32_t UI_Millis(void);
 #endif   /*LV_TICK_CUSTOM*/
 
 typedef void * lv_disp_drv_user_data_t;             /*Type of user data in the display driver*/
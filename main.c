@@ -42,16 +42,15 @@
 #include "Periphs/inc/matrix.h"
 
 #include "UI/UI_Components.h"
+#include "UI/UI_Sched.h"
 #include "../lvgl/lvgl.h"
 
 #include "Bitmaps/Longhorn.h"
-#include "Bitmaps/Call_icon.h"
-#include "Bitmaps/Text_icon.h"
+#include "Bitmaps/Call_icon_i8.h"
+#include "Bitmaps/Text_icon_i8.h"
 
 
 LV_IMG_DECLARE(Longhorn);
-LV_IMG_DECLARE(Call_icon);
-LV_IMG_DECLARE(Text_icon);
 
 void lv_disp_buf_init(lv_disp_buf_t * disp_buf, void * buf1, void * buf2, uint32_t size_in_px_cnt);
 // For debug purposes, this program may peek at the I2C0 Master
@@ -68,6 +67,17 @@ void lv_disp_buf_init(lv_disp_buf_t * disp_buf, void * buf1, void * buf2, uint32
 #define DEBUGPRINTS 0
 #define SET_DATE_TIME 0
 #define TEST_GSM  0
+// FLUSHSTATS==1 prints the display flush statistics (runs, flush times, SPI traffic, LittlevGL heap, frame rate and CPU share) over UART0 when leaving a screen
+#define FLUSHSTATS 0
+// PROFILE==1 prints the per-frame render profile (render and flush times, pixels and invalid areas) of every screen over UART0 when 'p' is typed
+#define PROFILE 0
+// SPIBENCH==1 prints the display timing at each SSI0 clock profile over UART0 at startup
+#define SPIBENCH 0
+// SSI0 clock for the display: ILI9341_SPEED_SAFE, ILI9341_SPEED_FAST or ILI9341_SPEED_MAX
+#define DISPLAY_SPEED ILI9341_SPEED_SAFE
+// IDLE_TICKS is the number of clock updates (8 per second) on the main screen without a key
+// before the panel shows only the clock, in 8 colors; 0 never idles
+#define IDLE_TICKS 80
 // DEBUGWAIT is time between test prints as a parameter for the Delay() function
 // DEBUGWAIT==16,666,666 delays for 1 second between lines
 // This is useful if the computer terminal program has limited
@@ -79,13 +89,7 @@ void lv_disp_buf_init(lv_disp_buf_t * disp_buf, void * buf1, void * buf2, uint32
 #define RTC_ADDR 		0x68			// slave addr for PCF
 #define TIME_BASE		0x03			// Base addr
 
-enum screens {
-	MAIN_SCREEN,
-	CALL_SCREEN,
-	TEXT_SCREEN,
-	CALL_BUSY_SCREEN,
-	TEXT_BUSY_SCREEN
-} curScreen = MAIN_SCREEN, nextScreen = MAIN_SCREEN;
+enum screens curScreen = MAIN_SCREEN, nextScreen = MAIN_SCREEN;
 
 // delay function for testing from sysctl.c
 // which delays 3*ulCount cycles
@@ -109,12 +113,14 @@ enum screens {
 
 #endif
 	
+void DisableInterrupts(void); // Disable interrupts
+void EnableInterrupts(void);  // Enable interrupts
+
 extern int status;
 extern int ack_ct;
 DateTime dateTime;
 int stat;
 int i = 0;
-extern int isDisplayed;
 extern lv_obj_t* time_label;
 int updateClock = 0;
 char* full_time;
@@ -124,6 +130,8 @@ int chooseBox = 0;
 char* phoneNumber, *textMessageString;
 	
 int textQueued = 0;
+int idleTicks = 0;			// clock updates on the main screen since the last key
+int panelIdle = 0;			// 1 while only the clock band is lit
 
 void Timer1_ClockUpdate_Init(uint32_t period){
   SYSCTL_RCGCTIMER_R |= 0x02;   // 0) activate TIMER1
@@ -165,54 +173,116 @@ void getDisplayTime() {
 
 lv_obj_t* phoneLabel, *textLabel, *callTextBtn;
 
+/* KEYPAD INPUT */
+lv_group_t* keyGroup;			// group of the screen being built
+lv_obj_t* textMessageArea;
+void keyEvent(lv_obj_t* obj, lv_event_t event);
+
+/* obj joins the group of the screen being built; while it has the focus, keys reach keyEvent */
+void takeKeys(lv_obj_t* obj) {
+	lv_group_add_obj(keyGroup, obj);
+	lv_obj_set_event_cb(obj, keyEvent);
+}
+
+/* A text area adds the keys it is sent itself, before keyEvent sees them.  '*' and '#' are
+ * commands, so they only go on to keyEvent; in the message box the digits become letters. */
+lv_signal_cb_t taSignal;		// lv_ta's own signal function
+lv_res_t textSignal(lv_obj_t* ta, lv_signal_t sign, void* param) {
+	if (sign == LV_SIGNAL_CONTROL) {
+		char input = (char)*(uint32_t*)param;
+		if (input == '*' || input == '#')
+			return LV_RES_OK;
+		if (ta == textMessageArea) {
+			int del_prev;
+			char disp_char = numpad2TextInput(input, &del_prev);
+			if (del_prev)
+				lv_ta_del_char(ta);
+			if (disp_char)
+				lv_ta_add_char(ta, disp_char);
+			return LV_RES_OK;
+		}
+	}
+	return taSignal(ta, sign, param);
+}
+
+void takeText(lv_obj_t* ta) {
+	taSignal = lv_obj_get_signal_cb(ta);
+	lv_obj_set_signal_cb(ta, textSignal);
+	takeKeys(ta);
+}
+/* ************ */
+
 /* MAIN DISPLAY FUNCTIONS */
 lv_obj_t *call_btn, *text_btn, *time_field, *mainText;
 void mainDisplay() {
-		call_btn = createCallIcon(&Call_icon);
-		text_btn = createTextIcon(&Text_icon);
+		call_btn = createCallIcon(&Call_icon_i8);
+		text_btn = createTextIcon(&Text_icon_i8);
 		time_field = createTime("Time: TBD", 20, 20, 200, 60);
 		mainText = createMainText("JASP: Use it and Gasp!");
+		takeKeys(mainText);
+}
+
+/* Light only the clock band, in 8 colors; the panel keeps the rest of the screen */
+void mainIdle() {
+	lv_area_t band;
+	lv_obj_get_coords(time_field, &band);
+	if (ILI9341_SetPartialArea(band.y1, band.y2)) {
+		ILI9341_IdleMode(1);
+		panelIdle = 1;
+	}
+}
+
+/* Bring back the whole screen as it was, with no redraw */
+void mainWake() {
+	ILI9341_IdleMode(0);
+	ILI9341_NormalMode();
+	panelIdle = 0;
 }
 
-void mainDelete() {
-	lv_obj_del(mainText);
-	lv_obj_del(text_btn);
-	lv_obj_del(call_btn);
-	lv_obj_del(time_field);
+void mainReset() {
+	/* nothing to clear; the clock is updated while the screen is shown */
 }
 /* ************ */
 
 /* CALL DISPLAY FUNCTION */
-lv_obj_t* phoneTextArea, *textMessageArea;
+lv_obj_t* phoneTextArea;
+lv_obj_t *callNumberArea, *callButton;
 void callDisplay() {
-	phoneTextArea = createPhoneTextArea();
-	lv_ta_set_cursor_type(phoneTextArea, LV_CURSOR_BLOCK);
+	callNumberArea = createPhoneTextArea();
+	lv_ta_set_cursor_type(callNumberArea, LV_CURSOR_BLOCK);
+	takeText(callNumberArea);
 	
-	callTextBtn = createCallTextButton("Call (*)");
+	callButton = createCallTextButton("Call (*)");
 	return;
 }
 
-void callDelete() {
-	lv_obj_del(phoneTextArea);
-	lv_obj_del(callTextBtn);
+void callReset() {
+	phoneTextArea = callNumberArea;
+	callTextBtn = callButton;
+	lv_ta_set_text(phoneTextArea, "");
 }
 /* ************ */
 
 
 /* TEXT DISPLAY FUNCTION */
+lv_obj_t *textNumberArea, *textButton;
 void textDisplay() {
-	phoneTextArea = createPhoneTextArea();
-	lv_ta_set_cursor_type(phoneTextArea, LV_CURSOR_BLOCK);
-	
+	textNumberArea = createPhoneTextArea();
 	textMessageArea = createTextMessageArea();
-	callTextBtn = createCallTextButton("Text (*)");
+	textButton = createCallTextButton("Text (*)");
+	takeText(textNumberArea);
+	takeText(textMessageArea);
 	return;
 }
 
-void textDelete() {
-	lv_obj_del(phoneTextArea);
-	lv_obj_del(textMessageArea);
-	lv_obj_del(callTextBtn);
+void textReset() {
+	phoneTextArea = textNumberArea;
+	callTextBtn = textButton;
+	lv_ta_set_text(phoneTextArea, "");
+	lv_ta_set_text(textMessageArea, "");
+	lv_group_focus_obj(phoneTextArea);
+	lv_ta_set_cursor_type(phoneTextArea, LV_CURSOR_BLOCK);
+	lv_ta_set_cursor_type(textMessageArea, LV_CURSOR_NONE);
 	chooseBox = 0;
 }
 /* ************ */
@@ -220,23 +290,29 @@ void textDelete() {
 
 lv_obj_t* main_fn_text;
 /* CALL BUSY DISPLAY FUNCTIONS */
+lv_obj_t* callBusyText;
 void callBusyDisplay() {
-	char pt[25] = "Calling ";
-	main_fn_text = createMainText(strcat(pt, phoneNumber));
+	callBusyText = createMainText("Calling");
+	takeKeys(callBusyText);
 }
-void callBusyDelete() {
-	lv_obj_del(main_fn_text);
+void callBusyReset() {
+	char pt[25] = "Calling ";
+	main_fn_text = callBusyText;
+	setMainText(main_fn_text, strcat(pt, phoneNumber));
 }
 /**********/
 
 
 /* TEXT BUSY DISPLAY FUNCTIONS */
+lv_obj_t* textBusyText;
 void textBusyDisplay() {
-	char pt[25] = "Texting ";
-	main_fn_text = createMainText(strcat(pt, phoneNumber));
+	textBusyText = createMainText("Texting");
+	takeKeys(textBusyText);
 }
-void textBusyDelete() {
-	lv_obj_del(main_fn_text);
+void textBusyReset() {
+	char pt[25] = "Texting ";
+	main_fn_text = textBusyText;
+	setMainText(main_fn_text, strcat(pt, phoneNumber));
 }
 /**********/
 
@@ -244,6 +320,7 @@ void textBusyDelete() {
 
 void switchTextBox() {
 	if (chooseBox ^= 1) {			// choose textMessageArea
+		lv_group_focus_obj(textMessageArea);
 		lv_ta_set_cursor_type(phoneTextArea, LV_CURSOR_NONE);
 		lv_ta_set_cursor_type(textMessageArea, LV_CURSOR_BLOCK);
 	
@@ -254,27 +331,42 @@ void switchTextBox() {
 		nextScreen = TEXT_BUSY_SCREEN;
 		phoneNumber = lv_ta_get_text(phoneTextArea);
 		textMessageString = lv_ta_get_text(textMessageArea);
-		isDisplayed = 0;
 		textQueued = 1;
 	}
 }
 
-void (*renderScreen[])() = {mainDisplay, callDisplay, textDisplay, callBusyDisplay, textBusyDisplay};	
-void (*deleteScreen[])() = {mainDelete, callDelete, textDelete, callBusyDelete, textBusyDelete};
+/* Each screen is built once, the first time it is shown, and kept, along with the group of
+ * objects it takes keys with; the reset function clears what the last visit left on it */
+void (*buildScreen[NUM_SCREENS])() = {mainDisplay, callDisplay, textDisplay, callBusyDisplay, textBusyDisplay};	
+void (*resetScreen[NUM_SCREENS])() = {mainReset, callReset, textReset, callBusyReset, textBusyReset};
+char* screenNames[NUM_SCREENS] = {"main", "call", "text", "call busy", "text busy"};
+lv_obj_t* screenObj[NUM_SCREENS] = {NULL, NULL, NULL, NULL, NULL};
+lv_group_t* screenGroup[NUM_SCREENS] = {NULL, NULL, NULL, NULL, NULL};
+
+void showScreen(enum screens s) {
+	if (screenObj[s] == NULL) {
+		screenObj[s] = lv_obj_create(NULL, NULL);
+		lv_scr_load(screenObj[s]);		// the create functions add to the active screen
+		screenGroup[s] = keyGroup = createKeyGroup();
+		(*buildScreen[s])();
+	}
+	else
+		lv_scr_load(screenObj[s]);
+	lv_indev_set_group(keypad_indev, screenGroup[s]);
+	Profile_SetScreen(s);
+	(*resetScreen[s])();
+}
 
 
+/* Keys that the focused object of the screen passed on */
 void handleInput(char input) {
-	if (!input && !textQueued) 
-		return;
 	/* Main Screen Handler */
 	if (curScreen == MAIN_SCREEN) {
 		if (input == '*') {
 				nextScreen = CALL_SCREEN;
-				isDisplayed = 0;
 		}
 		else if (input == '#') {
 				nextScreen = TEXT_SCREEN;
-				isDisplayed = 0;
 		}
 	}
 	
@@ -282,79 +374,38 @@ void handleInput(char input) {
 	else if (curScreen == CALL_SCREEN) {
 		if (input == '#') {
 			nextScreen = MAIN_SCREEN;
-			isDisplayed = 0;
 		}
 		else if (input == '*') {
 			nextScreen = CALL_BUSY_SCREEN;
 			textQueued = 1;
 			phoneNumber = lv_ta_get_text(phoneTextArea);
-			isDisplayed = 0;
-		}
-		else {
-			lv_ta_add_char(phoneTextArea, input);
-			isDisplayed = 0;
 		}
-			
 	}
 	
 	/* Text Screen Handler */
 	else if (curScreen == TEXT_SCREEN) {
 		if (input == '#') {
 			nextScreen = MAIN_SCREEN;
-			isDisplayed = 0;
 		}
 		else if (input == '*') {
 			switchTextBox();
 		}
-		else {
-			if (chooseBox) {
-				// Text Message Box
-				int del_prev;
-				char disp_char = numpad2TextInput(input, &del_prev);
-				if (del_prev)
-					lv_ta_del_char(textMessageArea);
-				if (disp_char)
-					lv_ta_add_char(textMessageArea, disp_char);
-			}
-			else
-				// Phone NumberBox
-				lv_ta_add_char(phoneTextArea, input);
-		}
 	}
 	
 	/* CALL BUSY HANDLER */
 	else if (curScreen == CALL_BUSY_SCREEN) {
-		if (textQueued) {
-			/* Call Person*/ 
-			SIM800H_SetAudio();
-			SIM800H_SetSpeakerVolume();
-			SIM800H_SetMicVolume();
-			SIM800H_CallPhone(phoneNumber);
-			textQueued = 0;
-		}
 		if (input == '#') {
 			nextScreen = MAIN_SCREEN;
 			/* Hang up phone */ 
 			SIM800H_HangUpPhone();
 			//callTextBusy = 0;
-			isDisplayed = 0;
 		}
 	}
 
 	/* TEXT BUSY HANDLER */
 	else if (curScreen == TEXT_BUSY_SCREEN) {
-		if (textQueued) {
-			/* Text Person */
-			char phone_schema[15] = "\"";
-			strcat(strcat(phone_schema, phoneNumber), "\"\r");
-			SIM800H_SendText(phone_schema, textMessageString);
-			lv_label_set_text(main_fn_text, "Text was successful!");
-			isDisplayed = 0;
-			textQueued = 0;
-		}
 		if (input == '#') {
 			nextScreen = MAIN_SCREEN;
-			isDisplayed = 0;
 		}
 		
 	}
@@ -362,6 +413,41 @@ void handleInput(char input) {
 	return;
 }
 
+/* Places the call or sends the text once its busy screen is up */
+void sendQueued() {
+	/* CALL BUSY HANDLER */
+	if (curScreen == CALL_BUSY_SCREEN) {
+		/* Call Person*/ 
+		SIM800H_SetAudio();
+		SIM800H_SetSpeakerVolume();
+		SIM800H_SetMicVolume();
+		SIM800H_CallPhone(phoneNumber);
+		textQueued = 0;
+	}
+
+	/* TEXT BUSY HANDLER */
+	else if (curScreen == TEXT_BUSY_SCREEN) {
+		/* Text Person */
+		char phone_schema[15] = "\"";
+		strcat(strcat(phone_schema, phoneNumber), "\"\r");
+		SIM800H_SendText(phone_schema, textMessageString);
+		lv_label_set_text(main_fn_text, "Text was successful!");
+		textQueued = 0;
+	}
+}
+
+/* LV_EVENT_KEY from the focused object of the active screen (lv_task_handler reads the keypad) */
+void keyEvent(lv_obj_t* obj, lv_event_t event) {
+	if (event != LV_EVENT_KEY)
+		return;
+	idleTicks = 0;
+	if (panelIdle) {
+		mainWake();			// the key only wakes the screen
+		return;
+	}
+	handleInput((char)*(const uint32_t*)lv_event_get_data());
+}
+
 
 int main(void){
   PLL_Init(Bus80MHz);
@@ -373,16 +459,27 @@ int main(void){
 		while(1) {
 		};
 	#else
+	ILI9341_InitR_Start(INITR_BLACKTAB);         // panel resets and loads its tables from Timer3A meanwhile
 	SIM800H_Init();
 	UART0_Init(5);
 	UART0_OutString("Example I2C");
 	PCF8523_I2C0_Init();
 	Timer1_ClockUpdate_Init(10000000);
 	/* LittleVGL */
-	ILI9341_InitR(INITR_BLACKTAB);
+	ILI9341_InitR_Wait();
+	ILI9341_SetPixelMode(ILI9341_PIXELS_16BIT);   // one SSI frame per pixel
+	ILI9341_SetAsync(1);                          // fills and bitmaps drain from the SSI0 interrupt
 	LittlevGL_Init();
 	Matrix_Init();
+	screenObj[MAIN_SCREEN] = lv_scr_act();
+	screenGroup[MAIN_SCREEN] = keyGroup = createKeyGroup();
 	mainDisplay();
+	lv_indev_set_group(keypad_indev, screenGroup[MAIN_SCREEN]);
+	#if SPIBENCH
+		UI_SpeedBenchmark(&Longhorn, DISPLAY_SPEED);
+	#else
+		ILI9341_SetSpeed(DISPLAY_SPEED);
+	#endif
 	#if SET_DATE_TIME
 		// Send Code
 			dateTime.seconds = 0x00;
@@ -403,22 +500,35 @@ int main(void){
 	#endif
 	while(1){
 		if (curScreen != nextScreen) {
-			lv_obj_clean(lv_scr_act());		// Clear screen
-			(*deleteScreen[curScreen])();	// Delete components
-			(*renderScreen[nextScreen])(); // Create components
+			#if FLUSHSTATS
+				FlushStats_Print(screenNames[curScreen]);
+				FlushStats_Reset();
+			#endif
+			showScreen(nextScreen);
 			curScreen = nextScreen;
 		}
-		if (!isDisplayed) {
-			lv_task_handler();
-			isDisplayed = 1;
-		}
-		if (updateClock && curScreen == MAIN_SCREEN) {
-			getDisplayTime();
+		lv_task_handler();			// only the LittlevGL tasks that are due, the keypad among them
+		if (updateClock) {
 			updateClock = 0;
-			isDisplayed = 0;
+			if (curScreen == MAIN_SCREEN) {
+				getDisplayTime();
+				if (IDLE_TICKS && !panelIdle && ++idleTicks >= IDLE_TICKS)
+					mainIdle();
+			}
+		}
+		if (textQueued)
+			sendQueued();
+	#if PROFILE
+		if (UART0_InCharNonBlock() == 'p') {		// the UART0 receive interrupt ends the sleep
+			for (unsigned s = 0; s < NUM_SCREENS; s++)
+				Profile_Print(s, screenNames[s]);
 		}
-		char num_input = Matrix_InChar();
-		handleInput(num_input);
+	#endif
+		UI_Governor();
+		DisableInterrupts();
+		if (!updateClock && curScreen == nextScreen && !textQueued)
+			UI_SchedSleep();		// until a LittlevGL task is due or an interrupt comes in
+		EnableInterrupts();
 		
 		
   //test display and number parser (can safely be skipped)